@@ -113,6 +113,33 @@ class TC_COMMON_API BIH
             delete[] dat.indices;
         }
         uint32 primCount() const { return uint32(objects.size()); }
+
+        /// Stores primitives in the order the leaves reference them, every leaf then covers a consecutive
+        /// run of the array. Returns false and leaves everything untouched if objects is not a permutation.
+        template <class PrimArray>
+        bool reorderPrimitives(PrimArray& primitives)
+        {
+            if (objects.size() != primitives.size())
+                return false;
+
+            std::vector<bool> seen(objects.size(), false);
+            for (uint32 index : objects)
+            {
+                if (index >= objects.size() || seen[index])
+                    return false;
+                seen[index] = true;
+            }
+
+            PrimArray sorted;
+            sorted.reserve(primitives.size());
+            for (uint32 index : objects)
+                sorted.push_back(primitives[index]);
+
+            primitives.swap(sorted);
+            for (uint32 i = 0; i < objects.size(); ++i)
+                objects[i] = i;
+            return true;
+        }
         G3D::AABox const& bound() const { return bounds; }
 
         template<typename RayCallback>
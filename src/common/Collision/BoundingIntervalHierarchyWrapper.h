@@ -19,10 +19,13 @@
 #define _BIH_WRAP
 
 #include "BoundingIntervalHierarchy.h"
-#include <G3D/Table.h>
-#include <G3D/Array.h>
-#include <G3D/Set.h>
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
 
+/// Objects inserted after the last tree build are kept in a short pending list that queries scan
+/// linearly, removed objects just leave a hole in the tree. The owner decides when needsRebuild()
+/// is worth acting on, so objects that keep moving (transports) do not force a rebuild per move.
 template<class T, class BoundsFunc = BoundsTrait<T> >
 class BIHWrap
 {
@@ -55,44 +58,68 @@ class BIHWrap
         }
     };
 
-    typedef G3D::Array<const T*> ObjArray;
+    // pending objects tolerated before a rebuild pays off over scanning them
+    static constexpr std::size_t MAX_PENDING_OBJECTS = 8;
+    // holes tolerated in the tree before it is rebuilt, relative to its size
+    static constexpr std::size_t MIN_REMOVED_OBJECTS = 8;
 
     BIH m_tree;
-    ObjArray m_objects;
-    G3D::Table<const T*, uint32> m_obj2Idx;
-    G3D::Set<const T*> m_objects_to_push;
-    int unbalanced_times;
+    std::vector<const T*> m_objects;                // tree slot to object, nullptr once removed
+    std::unordered_map<const T*, uint32> m_obj2Idx; // objects stored in the tree
+    std::vector<const T*> m_pending;                // inserted since the last build
+    std::size_t m_removed;
 
 public:
-    BIHWrap() : unbalanced_times(0) { }
+    BIHWrap() : m_removed(0) { }
 
     void insert(const T& obj)
     {
-        ++unbalanced_times;
-        m_objects_to_push.insert(&obj);
+        m_pending.push_back(&obj);
     }
 
     void remove(const T& obj)
     {
-        ++unbalanced_times;
-        uint32 Idx = 0;
-        const T * temp;
-        if (m_obj2Idx.getRemove(&obj, temp, Idx))
-            m_objects[Idx] = nullptr;
-        else
-            m_objects_to_push.remove(&obj);
+        auto itr = m_obj2Idx.find(&obj);
+        if (itr != m_obj2Idx.end())
+        {
+            m_objects[itr->second] = nullptr;
+            m_obj2Idx.erase(itr);
+            ++m_removed;
+            return;
+        }
+
+        auto pendingItr = std::find(m_pending.begin(), m_pending.end(), &obj);
+        if (pendingItr != m_pending.end())
+        {
+            *pendingItr = m_pending.back();
+            m_pending.pop_back();
+        }
+    }
+
+    bool needsRebuild() const
+    {
+        return m_pending.size() > MAX_PENDING_OBJECTS
+            || (m_removed >= MIN_REMOVED_OBJECTS && m_removed * 2 >= m_objects.size());
     }
 
     void balance()
     {
-        if (unbalanced_times == 0)
+        if (m_pending.empty() && !m_removed)
             return;
 
-        unbalanced_times = 0;
-        m_objects.fastClear();
-        m_obj2Idx.getKeys(m_objects);
-        m_objects_to_push.getMembers(m_objects);
-        //assert that m_obj2Idx has all the keys
+        std::vector<const T*> objects;
+        objects.reserve(m_obj2Idx.size() + m_pending.size());
+        for (const T* obj : m_objects)
+            if (obj)
+                objects.push_back(obj);
+        objects.insert(objects.end(), m_pending.begin(), m_pending.end());
+
+        m_pending.clear();
+        m_removed = 0;
+        m_obj2Idx.clear();
+        m_objects.swap(objects);
+        for (uint32 i = 0; i < m_objects.size(); ++i)
+            m_obj2Idx[m_objects[i]] = i;
 
         m_tree.build(m_objects, BoundsFunc::getBounds2);
     }
@@ -100,17 +127,22 @@ public:
     template<typename RayCallback>
     void intersectRay(const G3D::Ray& ray, RayCallback& intersectCallback, float& maxDist)
     {
-        balance();
-        MDLCallback<RayCallback> temp_cb(intersectCallback, m_objects.getCArray(), m_objects.size());
+        MDLCallback<RayCallback> temp_cb(intersectCallback, m_objects.data(), uint32(m_objects.size()));
         m_tree.intersectRay(ray, temp_cb, maxDist, true);
+
+        // a pending object may still be closer than the tree hit, maxDist only shrinks for closer hits
+        for (const T* obj : m_pending)
+            intersectCallback(ray, *obj, maxDist);
     }
 
     template<typename IsectCallback>
     void intersectPoint(const G3D::Vector3& point, IsectCallback& intersectCallback)
     {
-        balance();
-        MDLCallback<IsectCallback> callback(intersectCallback, m_objects.getCArray(), m_objects.size());
+        MDLCallback<IsectCallback> callback(intersectCallback, m_objects.data(), uint32(m_objects.size()));
         m_tree.intersectPoint(point, callback);
+
+        for (const T* obj : m_pending)
+            intersectCallback(point, *obj);
     }
 };
 
@@ -35,6 +35,9 @@ namespace {
 
 int CHECK_TREE_PERIOD = 200;
 
+// cells rebuilt per check, keeps the cost of a map update bounded however many gameobjects moved
+uint32 const MAX_NODE_REBUILDS_PER_CHECK = 16;
+
 } // namespace
 
 template<> struct HashTrait< GameObjectModel>{
@@ -61,30 +64,13 @@ typedef RegularGrid2D<GameObjectModel, BIHWrap<GameObjectModel> > ParentTree;
 struct DynTreeImpl : public ParentTree/*, public Intersectable*/
 {
     typedef GameObjectModel Model;
+    typedef BIHWrap<GameObjectModel> Node;
     typedef ParentTree base;
 
     DynTreeImpl() :
         rebalance_timer(CHECK_TREE_PERIOD),
-        unbalanced_times(0)
-    {
-    }
-
-    void insert(Model const& mdl)
-    {
-        base::insert(mdl);
-        ++unbalanced_times;
-    }
-
-    void remove(Model const& mdl)
-    {
-        base::remove(mdl);
-        ++unbalanced_times;
-    }
-
-    void balance()
+        rebuild_cursor(0)
     {
-        base::balance();
-        unbalanced_times = 0;
     }
 
     void update(uint32 difftime)
@@ -96,13 +82,32 @@ struct DynTreeImpl : public ParentTree/*, public Intersectable*/
         if (rebalance_timer.Passed())
         {
             rebalance_timer.Reset(CHECK_TREE_PERIOD);
-            if (unbalanced_times > 0)
-                balance();
+            rebuildNodes(MAX_NODE_REBUILDS_PER_CHECK);
+        }
+    }
+
+    // walks the cells round robin and rebuilds at most maxRebuilds of those whose pending lists got too long
+    void rebuildNodes(uint32 maxRebuilds)
+    {
+        uint32 const cellCount = CELL_NUMBER * CELL_NUMBER;
+        uint32 rebuilt = 0;
+        uint32 visited = 0;
+        for (; visited < cellCount && rebuilt < maxRebuilds; ++visited)
+        {
+            uint32 cell = (rebuild_cursor + visited) % cellCount;
+            Node* node = nodes[cell / CELL_NUMBER][cell % CELL_NUMBER];
+            if (node && node->needsRebuild())
+            {
+                node->balance();
+                ++rebuilt;
+            }
         }
+
+        rebuild_cursor = (rebuild_cursor + visited) % cellCount;
     }
 
     TimeTracker rebalance_timer;
-    int unbalanced_times;
+    uint32 rebuild_cursor;
 };
 
 DynamicMapTree::DynamicMapTree() : impl(new DynTreeImpl()) { }
@@ -19,12 +19,29 @@
 #include "Errors.h"
 #include "Log.h"
 #include "MapDefines.h"
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
 
 namespace MMAP
 {
     constexpr char MAP_FILE_NAME_FORMAT[] = "{}mmaps/{:03}.mmap";
     constexpr char TILE_FILE_NAME_FORMAT[] = "{}mmaps/{:03}{:02}{:02}.mmtile";
 
+    void MappedRegionDeleter::operator()(boost::interprocess::mapped_region* region) const
+    {
+        delete region;
+    }
+
+    MMapData::~MMapData()
+    {
+        for (NavMeshQuerySet::iterator i = navMeshQueries.begin(); i != navMeshQueries.end(); ++i)
+            dtFreeNavMeshQuery(i->second);
+
+        // tile data is owned by the file views in loadedTileRefs, detour does not free it
+        if (navMesh)
+            dtFreeNavMesh(navMesh);
+    }
+
     // ######################## MMapManager ########################
     MMapManager::~MMapManager()
     {
@@ -124,13 +141,30 @@ namespace MMAP
 
         // check if we already have this tile loaded
         uint32 packedGridPos = packTileID(x, y);
-        if (mmap->loadedTileRefs.find(packedGridPos) != mmap->loadedTileRefs.end())
-            return false;
+        auto tileItr = mmap->loadedTileRefs.find(packedGridPos);
+        if (tileItr != mmap->loadedTileRefs.end())
+        {
+            if (tileItr->second.referenced)
+                return false;
+
+            // grid was unloaded but the tile stayed resident, reuse it
+            tileItr->second.referenced = true;
+            mmap->unreferencedTiles.erase(tileItr->second.unreferencedItr);
+            ++tileHits;
+            TC_LOG_DEBUG("maps", "MMAP:loadMap: Reused resident mmtile {:03}[{:02}, {:02}]", mapId, x, y);
+            return true;
+        }
 
         // load this tile :: mmaps/MMMXXYY.mmtile
         std::string fileName = Trinity::StringFormat(TILE_FILE_NAME_FORMAT, basePath, mapId, x, y);
-        FILE* file = fopen(fileName.c_str(), "rb");
-        if (!file)
+        std::unique_ptr<boost::interprocess::mapped_region, MappedRegionDeleter> region;
+        try
+        {
+            boost::interprocess::file_mapping mapping(fileName.c_str(), boost::interprocess::read_only);
+            // detour writes links into the tile data, keep those pages private to the process
+            region.reset(new boost::interprocess::mapped_region(mapping, boost::interprocess::copy_on_write));
+        }
+        catch (boost::interprocess::interprocess_exception const&)
         {
             TC_LOG_DEBUG("maps", "MMAP:loadMap: Could not open mmtile file '{}'", fileName);
             return false;
@@ -138,90 +172,56 @@ namespace MMAP
 
         // read header
         MmapTileHeader fileHeader;
-        if (fread(&fileHeader, sizeof(MmapTileHeader), 1, file) != 1 || fileHeader.mmapMagic != MMAP_MAGIC)
+        if (region->get_size() < sizeof(MmapTileHeader))
         {
             TC_LOG_ERROR("maps", "MMAP:loadMap: Bad header in mmap {:03}{:02}{:02}.mmtile", mapId, x, y);
-            fclose(file);
             return false;
         }
 
-        if (fileHeader.mmapVersion != MMAP_VERSION)
+        memcpy(&fileHeader, region->get_address(), sizeof(MmapTileHeader));
+        if (fileHeader.mmapMagic != MMAP_MAGIC)
         {
-            TC_LOG_ERROR("maps", "MMAP:loadMap: {:03}{:02}{:02}.mmtile was built with generator v{}, expected v{}",
-                mapId, x, y, fileHeader.mmapVersion, MMAP_VERSION);
-            fclose(file);
+            TC_LOG_ERROR("maps", "MMAP:loadMap: Bad header in mmap {:03}{:02}{:02}.mmtile", mapId, x, y);
             return false;
         }
 
-        long pos = ftell(file);
-        fseek(file, 0, SEEK_END);
-        if (pos < 0 || static_cast<int32>(fileHeader.size) > ftell(file) - pos)
+        if (fileHeader.mmapVersion != MMAP_VERSION)
         {
-            TC_LOG_ERROR("maps", "MMAP:loadMap: {:03}{:02}{:02}.mmtile has corrupted data size", mapId, x, y);
-            fclose(file);
+            TC_LOG_ERROR("maps", "MMAP:loadMap: {:03}{:02}{:02}.mmtile was built with generator v{}, expected v{}",
+                mapId, x, y, fileHeader.mmapVersion, MMAP_VERSION);
             return false;
         }
 
-        fseek(file, pos, SEEK_SET);
-
-        unsigned char* data = (unsigned char*)dtAlloc(fileHeader.size, DT_ALLOC_PERM);
-        ASSERT(data);
-
-        size_t result = fread(data, fileHeader.size, 1, file);
-        if (!result)
+        if (fileHeader.size > region->get_size() - sizeof(MmapTileHeader))
         {
-            TC_LOG_ERROR("maps", "MMAP:loadMap: Bad header or data in mmap {:03}{:02}{:02}.mmtile", mapId, x, y);
-            fclose(file);
+            TC_LOG_ERROR("maps", "MMAP:loadMap: {:03}{:02}{:02}.mmtile has corrupted data size", mapId, x, y);
             return false;
         }
 
-        fclose(file);
-
+        unsigned char* data = static_cast<unsigned char*>(region->get_address()) + sizeof(MmapTileHeader);
         dtMeshHeader* header = (dtMeshHeader*)data;
         dtTileRef tileRef = 0;
 
-        // memory allocated for data is now managed by detour, and will be deallocated when the tile is removed
-        if (dtStatusSucceed(mmap->navMesh->addTile(data, fileHeader.size, DT_TILE_FREE_DATA, 0, &tileRef)))
+        // data stays owned by the mapped region, detour must not free it when the tile is removed
+        if (dtStatusSucceed(mmap->navMesh->addTile(data, fileHeader.size, 0, 0, &tileRef)))
         {
-            mmap->loadedTileRefs.insert(std::pair<uint32, dtTileRef>(packedGridPos, tileRef));
+            mmap->loadedTileRefs.emplace(packedGridPos, MMapTile{ tileRef, std::move(region), fileHeader.size, true, mmap->unreferencedTiles.end() });
             ++loadedTiles;
+            ++tileMisses;
+            mmap->residentTileBytes += fileHeader.size;
+            residentTileBytes += fileHeader.size;
             TC_LOG_DEBUG("maps", "MMAP:loadMap: Loaded mmtile {:03}[{:02}, {:02}] into {:03}[{:02}, {:02}]", mapId, x, y, mapId, header->x, header->y);
+
+            evictUnreferencedTiles(mmap, mapId);
             return true;
         }
         else
         {
             TC_LOG_ERROR("maps", "MMAP:loadMap: Could not load {:03}{:02}{:02}.mmtile into navmesh", mapId, x, y);
-            dtFree(data);
             return false;
         }
     }
 
-    bool MMapManager::loadMapInstance(std::string const& basePath, uint32 mapId, uint32 instanceId)
-    {
-        if (!loadMapData(basePath, mapId))
-            return false;
-
-        MMapData* mmap = loadedMMaps[mapId];
-        auto [queryItr, inserted] = mmap->navMeshQueries.try_emplace(instanceId, nullptr);
-        if (!inserted)
-            return true;
-
-        // allocate mesh query
-        dtNavMeshQuery* query = dtAllocNavMeshQuery();
-        ASSERT(query);
-        if (dtStatusFailed(query->init(mmap->navMesh, 1024)))
-        {
-            dtFreeNavMeshQuery(query);
-            mmap->navMeshQueries.erase(queryItr);
-            TC_LOG_ERROR("maps", "MMAP:GetNavMeshQuery: Failed to initialize dtNavMeshQuery for mapId {:03} instanceId {}", mapId, instanceId);
-            return false;
-        }
-
-        TC_LOG_DEBUG("maps", "MMAP:GetNavMeshQuery: created dtNavMeshQuery for mapId {:03} instanceId {}", mapId, instanceId);
-        queryItr->second = query;
-        return true;
-    }
-
     bool MMapManager::unloadMap(uint32 mapId, int32 x, int32 y)
     {
         // check if we have this map loaded
@@ -237,33 +237,21 @@ namespace MMAP
 
         // check if we have this tile loaded
         uint32 packedGridPos = packTileID(x, y);
-        if (mmap->loadedTileRefs.find(packedGridPos) == mmap->loadedTileRefs.end())
+        auto tileItr = mmap->loadedTileRefs.find(packedGridPos);
+        if (tileItr == mmap->loadedTileRefs.end() || !tileItr->second.referenced)
         {
             // file may not exist, therefore not loaded
             TC_LOG_DEBUG("maps", "MMAP:unloadMap: Asked to unload not loaded navmesh tile. {:03}{:02}{:02}.mmtile", mapId, x, y);
             return false;
         }
 
-        dtTileRef tileRef = mmap->loadedTileRefs[packedGridPos];
+        // keep the tile around in case the grid is loaded again soon, the budget decides when it really goes
+        tileItr->second.referenced = false;
+        tileItr->second.unreferencedItr = mmap->unreferencedTiles.insert(mmap->unreferencedTiles.end(), packedGridPos);
+        TC_LOG_DEBUG("maps", "MMAP:unloadMap: Released mmtile {:03}[{:02}, {:02}] from {:03}", mapId, x, y, mapId);
 
-        // unload, and mark as non loaded
-        if (dtStatusFailed(mmap->navMesh->removeTile(tileRef, nullptr, nullptr)))
-        {
-            // this is technically a memory leak
-            // if the grid is later reloaded, dtNavMesh::addTile will return error but no extra memory is used
-            // we cannot recover from this error - assert out
-            TC_LOG_ERROR("maps", "MMAP:unloadMap: Could not unload {:03}{:02}{:02}.mmtile from navmesh", mapId, x, y);
-            ABORT();
-        }
-        else
-        {
-            mmap->loadedTileRefs.erase(packedGridPos);
-            --loadedTiles;
-            TC_LOG_DEBUG("maps", "MMAP:unloadMap: Unloaded mmtile {:03}[{:02}, {:02}] from {:03}", mapId, x, y, mapId);
-            return true;
-        }
-
-        return false;
+        evictUnreferencedTiles(mmap, mapId);
+        return true;
     }
 
     bool MMapManager::unloadMap(uint32 mapId)
@@ -278,18 +266,8 @@ namespace MMAP
 
         // unload all tiles from given map
         MMapData* mmap = itr->second;
-        for (MMapTileSet::iterator i = mmap->loadedTileRefs.begin(); i != mmap->loadedTileRefs.end(); ++i)
-        {
-            uint32 x = (i->first >> 16);
-            uint32 y = (i->first & 0x0000FFFF);
-            if (dtStatusFailed(mmap->navMesh->removeTile(i->second, nullptr, nullptr)))
-                TC_LOG_ERROR("maps", "MMAP:unloadMap: Could not unload {:03}{:02}{:02}.mmtile from navmesh", mapId, x, y);
-            else
-            {
-                --loadedTiles;
-                TC_LOG_DEBUG("maps", "MMAP:unloadMap: Unloaded mmtile {:03}[{:02}, {:02}] from {:03}", mapId, x, y, mapId);
-            }
-        }
+        while (!mmap->loadedTileRefs.empty())
+            removeTile(mmap, mapId, mmap->loadedTileRefs.begin()->first);
 
         delete mmap;
         itr->second = nullptr;
@@ -298,30 +276,41 @@ namespace MMAP
         return true;
     }
 
-    bool MMapManager::unloadMapInstance(uint32 mapId, uint32 instanceId)
+    void MMapManager::removeTile(MMapData* mmap, uint32 mapId, uint32 packedGridPos)
     {
-        // check if we have this map loaded
-        MMapDataSet::const_iterator itr = GetMMapData(mapId);
-        if (itr == loadedMMaps.end())
-        {
-            // file may not exist, therefore not loaded
-            TC_LOG_DEBUG("maps", "MMAP:unloadMapInstance: Asked to unload not loaded navmesh map {:03}", mapId);
-            return false;
-        }
+        auto tileItr = mmap->loadedTileRefs.find(packedGridPos);
+        ASSERT(tileItr != mmap->loadedTileRefs.end());
 
-        MMapData* mmap = itr->second;
-        auto queryItr = mmap->navMeshQueries.find(instanceId);
-        if (queryItr == mmap->navMeshQueries.end())
+        uint32 x = (packedGridPos >> 16);
+        uint32 y = (packedGridPos & 0x0000FFFF);
+
+        // unload, and mark as non loaded
+        if (dtStatusFailed(mmap->navMesh->removeTile(tileItr->second.ref, nullptr, nullptr)))
         {
-            TC_LOG_DEBUG("maps", "MMAP:unloadMapInstance: Asked to unload not loaded dtNavMeshQuery mapId {:03} instanceId {}", mapId, instanceId);
-            return false;
+            // the navmesh would keep pointing into the file view we are about to release
+            // we cannot recover from this error - assert out
+            TC_LOG_ERROR("maps", "MMAP:unloadMap: Could not unload {:03}{:02}{:02}.mmtile from navmesh", mapId, x, y);
+            ABORT();
         }
 
-        dtFreeNavMeshQuery(queryItr->second);
-        mmap->navMeshQueries.erase(queryItr);
-        TC_LOG_DEBUG("maps", "MMAP:unloadMapInstance: Unloaded mapId {:03} instanceId {}", mapId, instanceId);
+        if (!tileItr->second.referenced)
+            mmap->unreferencedTiles.erase(tileItr->second.unreferencedItr);
 
-        return true;
+        mmap->residentTileBytes -= tileItr->second.dataSize;
+        residentTileBytes -= tileItr->second.dataSize;
+        mmap->loadedTileRefs.erase(tileItr);
+        --loadedTiles;
+        TC_LOG_DEBUG("maps", "MMAP:unloadMap: Unloaded mmtile {:03}[{:02}, {:02}] from {:03}", mapId, x, y, mapId);
+    }
+
+    void MMapManager::evictUnreferencedTiles(MMapData* mmap, uint32 mapId)
+    {
+        // the budget is per map, other navmeshes may be searched by other map threads right now and cannot be touched here
+        while (mmap->residentTileBytes > tileMemoryBudgetPerMap && !mmap->unreferencedTiles.empty())
+        {
+            removeTile(mmap, mapId, mmap->unreferencedTiles.front());
+            ++tileEvictions;
+        }
     }
 
     dtNavMesh const* MMapManager::GetNavMesh(uint32 mapId)
@@ -333,16 +322,38 @@ namespace MMAP
         return itr->second->navMesh;
     }
 
-    dtNavMeshQuery const* MMapManager::GetNavMeshQuery(uint32 mapId, uint32 instanceId)
+    dtNavMeshQuery const* MMapManager::GetNavMeshQuery(uint32 mapId)
     {
         auto itr = GetMMapData(mapId);
         if (itr == loadedMMaps.end())
             return nullptr;
 
-        auto queryItr = itr->second->navMeshQueries.find(instanceId);
-        if (queryItr == itr->second->navMeshQueries.end())
+        MMapData* mmap = itr->second;
+        std::thread::id threadId = std::this_thread::get_id();
+
+        std::lock_guard<std::mutex> lock(mmap->navMeshQueriesLock);
+        auto [queryItr, inserted] = mmap->navMeshQueries.try_emplace(threadId, nullptr);
+        if (!inserted)
+            return queryItr->second;
+
+        // allocate mesh query for this thread
+        dtNavMeshQuery* query = dtAllocNavMeshQuery();
+        ASSERT(query);
+        if (dtStatusFailed(query->init(mmap->navMesh, 1024)))
+        {
+            dtFreeNavMeshQuery(query);
+            mmap->navMeshQueries.erase(queryItr);
+            TC_LOG_ERROR("maps", "MMAP:GetNavMeshQuery: Failed to initialize dtNavMeshQuery for mapId {:03}", mapId);
             return nullptr;
+        }
+
+        TC_LOG_DEBUG("maps", "MMAP:GetNavMeshQuery: created dtNavMeshQuery for mapId {:03}, {} queries in use", mapId, mmap->navMeshQueries.size());
+        queryItr->second = query;
+        return query;
+    }
 
-        return queryItr->second;
+    MMapManager::TileCacheStatistics MMapManager::getTileCacheStatistics() const
+    {
+        return { tileHits.load(), tileMisses.load(), tileEvictions.load(), residentTileBytes.load() };
     }
 }
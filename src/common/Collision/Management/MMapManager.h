@@ -21,34 +21,54 @@
 #include "Define.h"
 #include "DetourNavMesh.h"
 #include "DetourNavMeshQuery.h"
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
+namespace boost::interprocess
+{
+    class mapped_region;
+}
+
 //  move map related classes
 namespace MMAP
 {
-    typedef std::unordered_map<uint32, dtTileRef> MMapTileSet;
-    typedef std::unordered_map<uint32, dtNavMeshQuery*> NavMeshQuerySet;
+    struct TC_COMMON_API MappedRegionDeleter
+    {
+        void operator()(boost::interprocess::mapped_region* region) const;
+    };
+
+    struct MMapTile
+    {
+        dtTileRef ref;
+        std::unique_ptr<boost::interprocess::mapped_region, MappedRegionDeleter> region;  // file view the navmesh reads the tile data from
+        uint32 dataSize;
+        bool referenced;                                                // a loaded grid still uses this tile
+        std::list<uint32>::iterator unreferencedItr;                   // position in MMapData::unreferencedTiles when not referenced
+    };
+
+    typedef std::unordered_map<uint32, MMapTile> MMapTileSet;
+    typedef std::unordered_map<std::thread::id, dtNavMeshQuery*> NavMeshQuerySet;
 
     // dummy struct to hold map's mmap data
     struct TC_COMMON_API MMapData
     {
         MMapData(dtNavMesh* mesh) : navMesh(mesh) { }
-        ~MMapData()
-        {
-            for (NavMeshQuerySet::iterator i = navMeshQueries.begin(); i != navMeshQueries.end(); ++i)
-                dtFreeNavMeshQuery(i->second);
-
-            if (navMesh)
-                dtFreeNavMesh(navMesh);
-        }
+        ~MMapData();
 
-        // we have to use single dtNavMeshQuery for every instance, since those are not thread safe
-        NavMeshQuerySet navMeshQueries;     // instanceId to query
+        // dtNavMeshQuery is not thread safe, every thread searching this mesh gets its own
+        std::mutex navMeshQueriesLock;
+        NavMeshQuerySet navMeshQueries;     // thread to query
 
         dtNavMesh* navMesh;
-        MMapTileSet loadedTileRefs;        // maps [map grid coords] to [dtTile]
+        MMapTileSet loadedTileRefs;         // maps [map grid coords] to [dtTile]
+        std::list<uint32> unreferencedTiles; // tiles kept resident after their grid unloaded, least recently used first
+        std::size_t residentTileBytes = 0;  // data size of all tiles in loadedTileRefs
     };
 
     typedef std::unordered_map<uint32, MMapData*> MMapDataSet;
@@ -58,30 +78,50 @@ namespace MMAP
     class TC_COMMON_API MMapManager
     {
         public:
-            MMapManager() : loadedTiles(0), thread_safe_environment(true) {}
+            struct TileCacheStatistics
+            {
+                uint64 Hits;            // tile requested again while still resident
+                uint64 Misses;          // tile read from disk
+                uint64 Evictions;       // unreferenced tile dropped to keep its map within the memory budget
+                uint64 ResidentBytes;   // summed over all maps
+            };
+
+            MMapManager() : loadedTiles(0), thread_safe_environment(true), tileMemoryBudgetPerMap(0), residentTileBytes(0),
+                tileHits(0), tileMisses(0), tileEvictions(0) {}
             ~MMapManager();
 
             void InitializeThreadUnsafe(const std::vector<uint32>& mapIds);
+            bool loadMapData(std::string const& basePath, uint32 mapId);
             bool loadMap(std::string const& basePath, uint32 mapId, int32 x, int32 y);
-            bool loadMapInstance(std::string const& basePath, uint32 mapId, uint32 instanceId);
             bool unloadMap(uint32 mapId, int32 x, int32 y);
             bool unloadMap(uint32 mapId);
-            bool unloadMapInstance(uint32 mapId, uint32 instanceId);
 
-            // the returned [dtNavMeshQuery const*] is NOT threadsafe
-            dtNavMeshQuery const* GetNavMeshQuery(uint32 mapId, uint32 instanceId);
+            // the returned [dtNavMeshQuery const*] belongs to the calling thread and must not be handed to other threads
+            dtNavMeshQuery const* GetNavMeshQuery(uint32 mapId);
             dtNavMesh const* GetNavMesh(uint32 mapId);
 
             uint32 getLoadedTilesCount() const { return loadedTiles; }
             uint32 getLoadedMapsCount() const { return uint32(loadedMMaps.size()); }
+
+            // tiles whose grid was unloaded stay in the navmesh until the resident tiles of their map exceed this many bytes
+            // soft limit, referenced tiles are never evicted and a map that stops loading tiles keeps what it has
+            void setTileMemoryBudgetPerMap(std::size_t bytes) { tileMemoryBudgetPerMap = bytes; }
+            TileCacheStatistics getTileCacheStatistics() const;
         private:
-            bool loadMapData(std::string const& basePath, uint32 mapId);
             uint32 packTileID(int32 x, int32 y);
+            void removeTile(MMapData* mmap, uint32 mapId, uint32 packedGridPos);
+            void evictUnreferencedTiles(MMapData* mmap, uint32 mapId);
 
             MMapDataSet::const_iterator GetMMapData(uint32 mapId) const;
             MMapDataSet loadedMMaps;
             uint32 loadedTiles;
             bool thread_safe_environment;
+
+            std::atomic<std::size_t> tileMemoryBudgetPerMap;
+            std::atomic<std::size_t> residentTileBytes;
+            std::atomic<uint64> tileHits;
+            std::atomic<uint64> tileMisses;
+            std::atomic<uint64> tileEvictions;
     };
 }
 
@@ -301,6 +301,46 @@ namespace VMAP
         triangles.swap(tri);
         TriBoundFunc bFunc(vertices);
         meshTree.build(triangles, bFunc);
+        sortMeshByTree();
+    }
+
+    void GroupModel::sortMeshByTree()
+    {
+        if (!meshTree.reorderPrimitives(triangles))
+            return;
+
+        uint32 const vertexCount = uint32(vertices.size());
+        for (MeshTriangle const& tri : triangles)
+            if (tri.idx0 >= vertexCount || tri.idx1 >= vertexCount || tri.idx2 >= vertexCount)
+                return;
+
+        std::vector<uint32> remap(vertexCount, std::numeric_limits<uint32>::max());
+        std::vector<Vector3> sortedVertices;
+        sortedVertices.reserve(vertexCount);
+
+        auto remapIndex = [&](uint32& idx)
+        {
+            if (remap[idx] == std::numeric_limits<uint32>::max())
+            {
+                remap[idx] = uint32(sortedVertices.size());
+                sortedVertices.push_back(vertices[idx]);
+            }
+            idx = remap[idx];
+        };
+
+        for (MeshTriangle& tri : triangles)
+        {
+            remapIndex(tri.idx0);
+            remapIndex(tri.idx1);
+            remapIndex(tri.idx2);
+        }
+
+        // vertices no triangle uses keep their relative order at the end
+        for (uint32 i = 0; i < vertexCount; ++i)
+            if (remap[i] == std::numeric_limits<uint32>::max())
+                sortedVertices.push_back(vertices[i]);
+
+        vertices.swap(sortedVertices);
     }
 
     bool GroupModel::writeToFile(FILE* wf)
@@ -383,6 +423,7 @@ namespace VMAP
         // read mesh BIH
         if (result && !readChunk(rf, chunk, "MBIH", 4)) result = false;
         if (result) result = meshTree.readFromFile(rf);
+        if (result) sortMeshByTree();
 
         // write liquid data
         if (result && !readChunk(rf, chunk, "LIQU", 4)) result = false;
@@ -103,6 +103,9 @@ namespace VMAP
             std::vector<MeshTriangle> triangles;
             BIH meshTree;
             WmoLiquid* iLiquid;
+
+            //! lay out triangles in tree leaf order and vertices in order of first use, so ray traversal walks memory mostly forward
+            void sortMeshByTree();
     };
 
     /*! Holds a model (converted M2 or WMO) in its original coordinate space */
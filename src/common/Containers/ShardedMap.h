@@ -0,0 +1,96 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef TRINITYCORE_SHARDED_MAP_H
+#define TRINITYCORE_SHARDED_MAP_H
+
+#include <array>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace Trinity::Containers
+{
+// Hash map split into independently locked shards, meant for read-mostly lookups
+// from many threads. Readers only ever share the lock of the shard their key hashes to.
+template <class Key, class Value, std::size_t ShardCount = 16, class Hash = std::hash<Key>>
+class ShardedMap
+{
+    static_assert(ShardCount > 0 && (ShardCount & (ShardCount - 1)) == 0, "ShardCount must be a power of two");
+
+public:
+    void insert_or_assign(Key const& key, Value const& value)
+    {
+        Shard& shard = get_shard(key);
+        std::unique_lock<std::shared_mutex> lock(shard.Lock);
+        shard.Storage.insert_or_assign(key, value);
+    }
+
+    bool erase(Key const& key)
+    {
+        Shard& shard = get_shard(key);
+        std::unique_lock<std::shared_mutex> lock(shard.Lock);
+        return shard.Storage.erase(key) != 0;
+    }
+
+    // returns a copy of the stored value or a value-initialized Value when key is not present
+    Value lookup(Key const& key) const
+    {
+        Shard const& shard = get_shard(key);
+        std::shared_lock<std::shared_mutex> lock(shard.Lock);
+        auto itr = shard.Storage.find(key);
+        return itr != shard.Storage.end() ? itr->second : Value();
+    }
+
+    std::size_t size() const
+    {
+        std::size_t size = 0;
+        for (Shard const& shard : _shards)
+        {
+            std::shared_lock<std::shared_mutex> lock(shard.Lock);
+            size += shard.Storage.size();
+        }
+
+        return size;
+    }
+
+private:
+    // aligned to keep the reader counts of neighbouring shards off the same cache line
+    struct alignas(64) Shard
+    {
+        mutable std::shared_mutex Lock;
+        std::unordered_map<Key, Value, Hash> Storage;
+    };
+
+    static std::size_t get_shard_index(Key const& key)
+    {
+        // mix the high bits in, std::hash is often the identity for integers
+        std::size_t hash = Hash()(key);
+        hash ^= hash >> 16;
+        hash *= 0x9E3779B1u;
+        hash ^= hash >> 16;
+        return hash & (ShardCount - 1);
+    }
+
+    Shard& get_shard(Key const& key) { return _shards[get_shard_index(key)]; }
+    Shard const& get_shard(Key const& key) const { return _shards[get_shard_index(key)]; }
+
+    std::array<Shard, ShardCount> _shards;
+};
+}
+
+#endif // TRINITYCORE_SHARDED_MAP_H
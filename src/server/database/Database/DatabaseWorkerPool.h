@@ -62,6 +62,12 @@ class DatabaseWorkerPool
             return _connectionInfo.get();
         }
 
+        //! Number of connections synchronous queries are spread over
+        inline uint8 GetSynchThreadCount() const
+        {
+            return _synch_threads;
+        }
+
         /**
             Delayed one-way statement methods.
         */
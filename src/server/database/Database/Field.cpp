@@ -26,11 +26,27 @@ Field::Field() : _value(nullptr), _length(0), _meta(nullptr)
 
 Field::~Field() = default;
 
+// Prepared statement results hold values in the native representation of their column type, so reading a column
+// with its matching getter is a plain load that needs neither the converter nor its truncation check
+template<typename T>
+static bool GetNativeValue(char const* data, QueryResultFieldMetadata const* meta, DatabaseFieldTypes type, T& value)
+{
+    if (meta->Type != type || !meta->BinaryProtocol)
+        return false;
+
+    memcpy(&value, data, sizeof(T));
+    return true;
+}
+
 uint8 Field::GetUInt8() const
 {
     if (!_value)
         return 0;
 
+    uint8 value;
+    if (GetNativeValue(_value, _meta, DatabaseFieldTypes::UInt8, value))
+        return value;
+
     return _meta->Converter->GetUInt8(_value, _length, _meta);
 }
 
@@ -39,6 +55,10 @@ int8 Field::GetInt8() const
     if (!_value)
         return 0;
 
+    int8 value;
+    if (GetNativeValue(_value, _meta, DatabaseFieldTypes::Int8, value))
+        return value;
+
     return _meta->Converter->GetInt8(_value, _length, _meta);
 }
 
@@ -47,6 +67,10 @@ uint16 Field::GetUInt16() const
     if (!_value)
         return 0;
 
+    uint16 value;
+    if (GetNativeValue(_value, _meta, DatabaseFieldTypes::UInt16, value))
+        return value;
+
     return _meta->Converter->GetUInt16(_value, _length, _meta);
 }
 
@@ -55,6 +79,10 @@ int16 Field::GetInt16() const
     if (!_value)
         return 0;
 
+    int16 value;
+    if (GetNativeValue(_value, _meta, DatabaseFieldTypes::Int16, value))
+        return value;
+
     return _meta->Converter->GetInt16(_value, _length, _meta);
 }
 
@@ -63,6 +91,10 @@ uint32 Field::GetUInt32() const
     if (!_value)
         return 0;
 
+    uint32 value;
+    if (GetNativeValue(_value, _meta, DatabaseFieldTypes::UInt32, value))
+        return value;
+
     return _meta->Converter->GetUInt32(_value, _length, _meta);
 }
 
@@ -71,6 +103,10 @@ int32 Field::GetInt32() const
     if (!_value)
         return 0;
 
+    int32 value;
+    if (GetNativeValue(_value, _meta, DatabaseFieldTypes::Int32, value))
+        return value;
+
     return _meta->Converter->GetInt32(_value, _length, _meta);
 }
 
@@ -79,6 +115,10 @@ uint64 Field::GetUInt64() const
     if (!_value)
         return 0;
 
+    uint64 value;
+    if (GetNativeValue(_value, _meta, DatabaseFieldTypes::UInt64, value))
+        return value;
+
     return _meta->Converter->GetUInt64(_value, _length, _meta);
 }
 
@@ -87,6 +127,10 @@ int64 Field::GetInt64() const
     if (!_value)
         return 0;
 
+    int64 value;
+    if (GetNativeValue(_value, _meta, DatabaseFieldTypes::Int64, value))
+        return value;
+
     return _meta->Converter->GetInt64(_value, _length, _meta);
 }
 
@@ -95,6 +139,10 @@ float Field::GetFloat() const
     if (!_value)
         return 0.0f;
 
+    float value;
+    if (GetNativeValue(_value, _meta, DatabaseFieldTypes::Float, value))
+        return value;
+
     return _meta->Converter->GetFloat(_value, _length, _meta);
 }
 
@@ -103,6 +151,10 @@ double Field::GetDouble() const
     if (!_value)
         return 0.0;
 
+    double value;
+    if (GetNativeValue(_value, _meta, DatabaseFieldTypes::Double, value))
+        return value;
+
     return _meta->Converter->GetDouble(_value, _length, _meta);
 }
 
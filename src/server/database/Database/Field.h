@@ -55,6 +55,7 @@ struct QueryResultFieldMetadata
     char const* TypeName = nullptr;
     uint32 Index = 0;
     DatabaseFieldTypes Type = DatabaseFieldTypes::Null;
+    bool BinaryProtocol = false;            // values are stored in their native representation (prepared statement results)
     BaseDatabaseResultValueConverter const* Converter = nullptr;
 };
 
@@ -92,6 +93,8 @@ class TC_DATABASE_API Field
 {
     friend class ResultSet;
     friend class PreparedResultSet;
+    template<typename... Columns>
+    friend class PreparedResultView;
 
     public:
         Field();
@@ -19,6 +19,7 @@
 #include "Common.h"
 #include "DatabaseWorker.h"
 #include "Log.h"
+#include "Metric.h"
 #include "MySQLHacks.h"
 #include "MySQLPreparedStatement.h"
 #include "PreparedStatement.h"
@@ -29,6 +30,19 @@
 #include <errmsg.h>
 #include "MySQLWorkaround.h"
 #include <mysqld_error.h>
+#include <bit>
+
+// Consecutive executions of the same single row insert in a transaction are sent as one statement inserting
+// up to this many rows. Only power of two row counts are prepared to limit the number of server side statements.
+#define MAX_MULTI_ROW_INSERT_ROWS 64
+
+// Upper bounds of the prepared statement latency histogram buckets in microseconds, the last bucket takes everything above
+static constexpr std::array<int64, MySQLStatementLatency::BUCKET_COUNT - 1> StatementLatencyBuckets =
+{
+    1000, 2000, 5000, 10000, 25000, 50000, 100000, 250000, 1000000
+};
+
+static constexpr Seconds StatementLatencyReportInterval = 10s;
 
 MySQLConnectionInfo::MySQLConnectionInfo(std::string const& infoString)
 {
@@ -76,6 +90,7 @@ void MySQLConnection::Close()
     // Stop the worker thread before the statements are cleared
     m_worker.reset();
 
+    m_multiRowStmts.clear();
     m_stmts.clear();
 
     if (m_Mysql)
@@ -182,6 +197,7 @@ uint32 MySQLConnection::Open()
 
 bool MySQLConnection::PrepareStatements()
 {
+    m_multiRowStmts.clear();
     DoPrepareStatements();
     return !m_prepareError;
 }
@@ -229,6 +245,7 @@ bool MySQLConnection::Execute(PreparedStatementBase* stmt)
     MYSQL_BIND* msql_BIND = m_mStmt->GetBind();
 
     uint32 _s = getMSTime();
+    TimePoint start = std::chrono::steady_clock::now();
 
     if (mysql_stmt_bind_param(msql_STMT, msql_BIND))
     {
@@ -255,6 +272,56 @@ bool MySQLConnection::Execute(PreparedStatementBase* stmt)
     }
 
     TC_LOG_DEBUG("sql.sql", "[{} ms] SQL(p): {}", getMSTimeDiff(_s, getMSTime()), m_mStmt->getQueryString());
+    RecordStatementLatency(index, std::chrono::steady_clock::now() - start);
+
+    m_mStmt->ClearParameters();
+    return true;
+}
+
+bool MySQLConnection::ExecuteMultiRowInsert(std::span<PreparedStatementBase* const> stmts)
+{
+    if (!m_Mysql)
+        return false;
+
+    uint32 index = stmts.front()->GetIndex();
+
+    MySQLPreparedStatement* m_mStmt = GetMultiRowInsertStatement(index, uint32(stmts.size()));
+    ASSERT(m_mStmt);            // Only called for statements that could be prepared
+
+    m_mStmt->BindParameters(stmts);
+
+    MYSQL_STMT* msql_STMT = m_mStmt->GetSTMT();
+    MYSQL_BIND* msql_BIND = m_mStmt->GetBind();
+
+    uint32 _s = getMSTime();
+    TimePoint start = std::chrono::steady_clock::now();
+
+    if (mysql_stmt_bind_param(msql_STMT, msql_BIND))
+    {
+        uint32 lErrno = mysql_errno(m_Mysql);
+        TC_LOG_ERROR("sql.sql", "SQL(p): {}\n [ERROR]: [{}] {}", m_mStmt->getQueryString(), lErrno, mysql_stmt_error(msql_STMT));
+
+        if (_HandleMySQLErrno(lErrno))  // If it returns true, an error was handled successfully (i.e. reconnection)
+            return ExecuteMultiRowInsert(stmts); // Try again
+
+        m_mStmt->ClearParameters();
+        return false;
+    }
+
+    if (mysql_stmt_execute(msql_STMT))
+    {
+        uint32 lErrno = mysql_errno(m_Mysql);
+        TC_LOG_ERROR("sql.sql", "SQL(p): {}\n [ERROR]: [{}] {}", m_mStmt->getQueryString(), lErrno, mysql_stmt_error(msql_STMT));
+
+        if (_HandleMySQLErrno(lErrno))  // If it returns true, an error was handled successfully (i.e. reconnection)
+            return ExecuteMultiRowInsert(stmts); // Try again
+
+        m_mStmt->ClearParameters();
+        return false;
+    }
+
+    TC_LOG_DEBUG("sql.sql", "[{} ms] SQL(p): {}", getMSTimeDiff(_s, getMSTime()), m_mStmt->getQueryString());
+    RecordStatementLatency(index, std::chrono::steady_clock::now() - start);
 
     m_mStmt->ClearParameters();
     return true;
@@ -277,6 +344,7 @@ bool MySQLConnection::_Query(PreparedStatementBase* stmt, MySQLPreparedStatement
     MYSQL_BIND* msql_BIND = m_mStmt->GetBind();
 
     uint32 _s = getMSTime();
+    TimePoint start = std::chrono::steady_clock::now();
 
     if (mysql_stmt_bind_param(msql_STMT, msql_BIND))
     {
@@ -304,6 +372,7 @@ bool MySQLConnection::_Query(PreparedStatementBase* stmt, MySQLPreparedStatement
     }
 
     TC_LOG_DEBUG("sql.sql", "[{} ms] SQL(p): {}", getMSTimeDiff(_s, getMSTime()), m_mStmt->getQueryString());
+    RecordStatementLatency(index, std::chrono::steady_clock::now() - start);
 
     m_mStmt->ClearParameters();
 
@@ -394,6 +463,7 @@ int MySQLConnection::ExecuteTransaction(std::shared_ptr<TransactionBase> transac
 
     BeginTransaction();
 
+    std::vector<PreparedStatementBase*> rows;
     for (auto itr = queries.begin(); itr != queries.end(); ++itr)
     {
         SQLElementData const& data = *itr;
@@ -403,7 +473,28 @@ int MySQLConnection::ExecuteTransaction(std::shared_ptr<TransactionBase> transac
             {
                 PreparedStatementBase* stmt = data.element.stmt;
                 ASSERT(stmt);
-                if (!Execute(stmt))
+
+                // Collect following executions of the same insert to send them as a single statement
+                rows.assign(1, stmt);
+                MySQLPreparedStatement* mStmt = GetPreparedStatement(stmt->GetIndex());
+                if (mStmt && mStmt->IsMultiRowInsertable())
+                {
+                    for (auto next = itr + 1; next != queries.end() && rows.size() < MAX_MULTI_ROW_INSERT_ROWS; ++next)
+                    {
+                        if (next->type != SQL_ELEMENT_PREPARED || next->element.stmt->GetIndex() != stmt->GetIndex())
+                            break;
+
+                        rows.push_back(next->element.stmt);
+                    }
+                }
+
+                // Rows that don't fit the prepared row count are picked up by the next iteration
+                uint32 rowCount = uint32(std::bit_floor(rows.size()));
+                if (rowCount > 1 && !GetMultiRowInsertStatement(stmt->GetIndex(), rowCount))
+                    rowCount = 1;
+
+                itr += rowCount - 1;
+                if (!(rowCount > 1 ? ExecuteMultiRowInsert(std::span(rows.data(), rowCount)) : Execute(stmt)))
                 {
                     TC_LOG_WARN("sql.sql", "Transaction aborted. {} queries not executed.", (uint32)queries.size());
                     int errorCode = GetLastError();
@@ -479,6 +570,41 @@ MySQLPreparedStatement* MySQLConnection::GetPreparedStatement(uint32 index)
     return ret;
 }
 
+MySQLPreparedStatement* MySQLConnection::GetMultiRowInsertStatement(uint32 index, uint32 rowCount)
+{
+    uint32 key = (index << 8) | rowCount;
+    auto itr = m_multiRowStmts.find(key);
+    if (itr != m_multiRowStmts.end())
+        return itr->second.get();
+
+    // failures are remembered as well, such statements keep being executed one row at a time
+    std::unique_ptr<MySQLPreparedStatement>& multiRowStmt = m_multiRowStmts[key];
+
+    MySQLPreparedStatement* singleRowStmt = GetPreparedStatement(index);
+    if (!singleRowStmt || !singleRowStmt->IsMultiRowInsertable())
+        return nullptr;
+
+    std::string sql = MySQLPreparedStatement::BuildMultiRowInsert(singleRowStmt->GetQueryString(), rowCount);
+    MYSQL_STMT* stmt = mysql_stmt_init(m_Mysql);
+    if (!stmt)
+    {
+        TC_LOG_ERROR("sql.sql", "In mysql_stmt_init() id: {}, sql: \"{}\"", index, sql);
+        TC_LOG_ERROR("sql.sql", "{}", mysql_error(m_Mysql));
+        return nullptr;
+    }
+
+    if (mysql_stmt_prepare(stmt, sql.c_str(), static_cast<unsigned long>(sql.size())))
+    {
+        TC_LOG_ERROR("sql.sql", "In mysql_stmt_prepare() id: {}, sql: \"{}\"", index, sql);
+        TC_LOG_ERROR("sql.sql", "{}", mysql_stmt_error(stmt));
+        mysql_stmt_close(stmt);
+        return nullptr;
+    }
+
+    multiRowStmt = std::make_unique<MySQLPreparedStatement>(reinterpret_cast<MySQLStmt*>(stmt), std::move(sql));
+    return multiRowStmt.get();
+}
+
 void MySQLConnection::PrepareStatement(uint32 index, std::string const& sql, ConnectionFlags flags)
 {
     // Check if specified query should be prepared on this connection
@@ -528,6 +654,49 @@ PreparedResultSet* MySQLConnection::Query(PreparedStatementBase* stmt)
     return new PreparedResultSet(mysqlStmt->GetSTMT(), result, rowCount, fieldCount);
 }
 
+void MySQLConnection::RecordStatementLatency(uint32 index, std::chrono::steady_clock::duration latency)
+{
+    if (!sMetric->IsEnabled())
+        return;
+
+    if (m_statementLatencies.size() <= index)
+        m_statementLatencies.resize(std::max<std::size_t>(m_stmts.size(), index + 1));
+
+    int64 microseconds = std::chrono::duration_cast<Microseconds>(latency).count();
+    MySQLStatementLatency& histogram = m_statementLatencies[index];
+    ++histogram.Buckets[std::lower_bound(StatementLatencyBuckets.begin(), StatementLatencyBuckets.end(), microseconds) - StatementLatencyBuckets.begin()];
+    histogram.Total += microseconds;
+
+    // reported from the thread using the connection, so a connection that stays idle keeps its last counts until its next statement
+    TimePoint now = std::chrono::steady_clock::now();
+    if (now < m_nextStatementLatencyReport)
+        return;
+
+    m_nextStatementLatencyReport = now + StatementLatencyReportInterval;
+    for (std::size_t i = 0; i < m_statementLatencies.size(); ++i)
+    {
+        MySQLStatementLatency& statement = m_statementLatencies[i];
+        if (!statement.Total)
+            continue;
+
+        std::string statementIndex = std::to_string(i);
+        for (std::size_t bucket = 0; bucket < statement.Buckets.size(); ++bucket)
+        {
+            if (!statement.Buckets[bucket])
+                continue;
+
+            std::string upperBound = bucket < StatementLatencyBuckets.size() ? std::to_string(StatementLatencyBuckets[bucket]) : "inf";
+            TC_METRIC_VALUE("db_statement_latency", uint64(statement.Buckets[bucket]), TC_METRIC_TAG("database", m_connectionInfo.database),
+                TC_METRIC_TAG("statement", statementIndex), TC_METRIC_TAG("le_us", upperBound));
+        }
+
+        TC_METRIC_VALUE("db_statement_latency_total_us", uint64(statement.Total), TC_METRIC_TAG("database", m_connectionInfo.database),
+            TC_METRIC_TAG("statement", statementIndex));
+
+        statement = MySQLStatementLatency();
+    }
+}
+
 bool MySQLConnection::_HandleMySQLErrno(uint32 errNo, uint8 attempts /*= 5*/)
 {
     switch (errNo)
@@ -20,10 +20,14 @@
 
 #include "Define.h"
 #include "DatabaseEnvFwd.h"
+#include "Duration.h"
+#include <array>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <span>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 template <typename T>
@@ -52,6 +56,15 @@ struct TC_DATABASE_API MySQLConnectionInfo
     std::string ssl;
 };
 
+//- Latency histogram of a single prepared statement, reported through Metric
+struct MySQLStatementLatency
+{
+    static constexpr std::size_t BUCKET_COUNT = 10;
+
+    std::array<uint32, BUCKET_COUNT> Buckets = { };
+    int64 Total = 0;                                        // microseconds
+};
+
 class TC_DATABASE_API MySQLConnection
 {
     template <class T> friend class DatabaseWorkerPool;
@@ -69,6 +82,7 @@ class TC_DATABASE_API MySQLConnection
 
         bool Execute(char const* sql);
         bool Execute(PreparedStatementBase* stmt);
+        bool ExecuteMultiRowInsert(std::span<PreparedStatementBase* const> stmts);
         ResultSet* Query(char const* sql);
         PreparedResultSet* Query(PreparedStatementBase* stmt);
         bool _Query(char const* sql, MySQLResult** pResult, MySQLField** pFields, uint64* pRowCount, uint32* pFieldCount);
@@ -93,6 +107,7 @@ class TC_DATABASE_API MySQLConnection
 
         uint32 GetServerVersion() const;
         MySQLPreparedStatement* GetPreparedStatement(uint32 index);
+        MySQLPreparedStatement* GetMultiRowInsertStatement(uint32 index, uint32 rowCount);
         void PrepareStatement(uint32 index, std::string const& sql, ConnectionFlags flags);
 
         virtual void DoPrepareStatements() = 0;
@@ -100,11 +115,13 @@ class TC_DATABASE_API MySQLConnection
         typedef std::vector<std::unique_ptr<MySQLPreparedStatement>> PreparedStatementContainer;
 
         PreparedStatementContainer           m_stmts;         //! PreparedStatements storage
+        std::unordered_map<uint32, std::unique_ptr<MySQLPreparedStatement>> m_multiRowStmts; //! Multi row variants of m_stmts, prepared on first use
         bool                                 m_reconnecting;  //! Are we reconnecting?
         bool                                 m_prepareError;  //! Was there any error while preparing statements?
 
     private:
         bool _HandleMySQLErrno(uint32 errNo, uint8 attempts = 5);
+        void RecordStatementLatency(uint32 index, std::chrono::steady_clock::duration latency);
 
         ProducerConsumerQueue<SQLOperation*>* m_queue;      //! Queue shared with other asynchronous connections.
         std::unique_ptr<DatabaseWorker> m_worker;           //! Core worker task.
@@ -112,6 +129,8 @@ class TC_DATABASE_API MySQLConnection
         MySQLConnectionInfo&  m_connectionInfo;             //! Connection info (used for logging)
         ConnectionFlags       m_connectionFlags;            //! Connection flags (for preparing relevant statements)
         std::mutex            m_Mutex;
+        std::vector<MySQLStatementLatency> m_statementLatencies; //! Indexed by prepared statement index
+        TimePoint             m_nextStatementLatencyReport;
 
         MySQLConnection(MySQLConnection const& right) = delete;
         MySQLConnection& operator=(MySQLConnection const& right) = delete;
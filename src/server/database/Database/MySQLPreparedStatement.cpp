@@ -20,6 +20,7 @@
 #include "Log.h"
 #include "MySQLHacks.h"
 #include "PreparedStatement.h"
+#include "Util.h"
 #include <chrono>
 #include <cstring>
 
@@ -42,6 +43,7 @@ MySQLPreparedStatement::MySQLPreparedStatement(MySQLStmt* stmt, std::string quer
 {
     /// Initialize variable parameters
     m_paramCount = mysql_stmt_param_count(stmt);
+    m_multiRowInsertable = m_paramCount && !BuildMultiRowInsert(m_queryString, 2).empty();
     m_paramsSet.assign(m_paramCount, false);
     m_bind = new MySQLBind[m_paramCount];
     memset(m_bind, 0, sizeof(MySQLBind) * m_paramCount);
@@ -65,20 +67,30 @@ MySQLPreparedStatement::~MySQLPreparedStatement()
 
 void MySQLPreparedStatement::BindParameters(PreparedStatementBase* stmt)
 {
-    m_stmt = stmt;     // Cross reference them for debug output
+    m_stmt = stmt;
+    BindParameters(std::span(&m_stmt, 1));
+}
+
+void MySQLPreparedStatement::BindParameters(std::span<PreparedStatementBase* const> stmts)
+{
+    m_stmt = stmts.front();     // Cross reference them for debug output
+    m_boundStmts = stmts;
 
-    uint8 pos = 0;
-    for (PreparedStatementData const& data : stmt->GetParameters())
+    uint32 pos = 0;
+    for (PreparedStatementBase* stmt : stmts)
     {
-        std::visit([&](auto&& param)
+        for (PreparedStatementData const& data : stmt->GetParameters())
         {
-            SetParameter(pos, param);
-        }, data.data);
-        ++pos;
+            std::visit([&](auto&& param)
+            {
+                SetParameter(pos, param);
+            }, data.data);
+            ++pos;
+        }
     }
 #ifdef _DEBUG
     if (pos < m_paramCount)
-        TC_LOG_WARN("sql.sql", "[WARNING]: BindParameters() for statement {} did not bind all allocated parameters", stmt->GetIndex());
+        TC_LOG_WARN("sql.sql", "[WARNING]: BindParameters() for statement {} did not bind all allocated parameters", m_stmt->GetIndex());
 #endif
 }
 
@@ -94,14 +106,14 @@ void MySQLPreparedStatement::ClearParameters()
     }
 }
 
-static bool ParamenterIndexAssertFail(uint32 stmtIndex, uint8 index, uint32 paramCount)
+static bool ParamenterIndexAssertFail(uint32 stmtIndex, uint32 index, uint32 paramCount)
 {
     TC_LOG_ERROR("sql.driver", "Attempted to bind parameter {}{} on a PreparedStatement {} (statement has only {} parameters)", uint32(index) + 1, (index == 1 ? "st" : (index == 2 ? "nd" : (index == 3 ? "rd" : "nd"))), stmtIndex, paramCount);
     return false;
 }
 
 //- Bind on mysql level
-void MySQLPreparedStatement::AssertValidIndex(uint8 index)
+void MySQLPreparedStatement::AssertValidIndex(uint32 index)
 {
     ASSERT(index < m_paramCount || ParamenterIndexAssertFail(m_stmt->GetIndex(), index, m_paramCount));
 
@@ -109,7 +121,7 @@ void MySQLPreparedStatement::AssertValidIndex(uint8 index)
         TC_LOG_ERROR("sql.sql", "[ERROR] Prepared Statement (id: {}) trying to bind value on already bound index ({}).", m_stmt->GetIndex(), index);
 }
 
-void MySQLPreparedStatement::SetParameter(uint8 index, std::nullptr_t)
+void MySQLPreparedStatement::SetParameter(uint32 index, std::nullptr_t)
 {
     AssertValidIndex(index);
     m_paramsSet[index] = true;
@@ -123,13 +135,13 @@ void MySQLPreparedStatement::SetParameter(uint8 index, std::nullptr_t)
     param->length = nullptr;
 }
 
-void MySQLPreparedStatement::SetParameter(uint8 index, bool value)
+void MySQLPreparedStatement::SetParameter(uint32 index, bool value)
 {
     SetParameter(index, uint8(value ? 1 : 0));
 }
 
 template<typename T>
-void MySQLPreparedStatement::SetParameter(uint8 index, T value)
+void MySQLPreparedStatement::SetParameter(uint32 index, T value)
 {
     AssertValidIndex(index);
     m_paramsSet[index] = true;
@@ -146,7 +158,7 @@ void MySQLPreparedStatement::SetParameter(uint8 index, T value)
     memcpy(param->buffer, &value, len);
 }
 
-void MySQLPreparedStatement::SetParameter(uint8 index, SystemTimePoint value)
+void MySQLPreparedStatement::SetParameter(uint32 index, SystemTimePoint value)
 {
     AssertValidIndex(index);
     m_paramsSet[index] = true;
@@ -173,7 +185,7 @@ void MySQLPreparedStatement::SetParameter(uint8 index, SystemTimePoint value)
     time->second_part = hms.subseconds().count();
 }
 
-void MySQLPreparedStatement::SetParameter(uint8 index, std::string const& value)
+void MySQLPreparedStatement::SetParameter(uint32 index, std::string const& value)
 {
     AssertValidIndex(index);
     m_paramsSet[index] = true;
@@ -190,7 +202,7 @@ void MySQLPreparedStatement::SetParameter(uint8 index, std::string const& value)
     memcpy(param->buffer, value.c_str(), len);
 }
 
-void MySQLPreparedStatement::SetParameter(uint8 index, std::vector<uint8> const& value)
+void MySQLPreparedStatement::SetParameter(uint32 index, std::vector<uint8> const& value)
 {
     AssertValidIndex(index);
     m_paramsSet[index] = true;
@@ -212,18 +224,78 @@ std::string MySQLPreparedStatement::getQueryString() const
     std::string queryString(m_queryString);
 
     size_t pos = 0;
-    for (PreparedStatementData const& data : m_stmt->GetParameters())
+    for (PreparedStatementBase const* stmt : m_boundStmts)
     {
-        pos = queryString.find('?', pos);
-
-        std::string replaceStr = std::visit([&](auto&& data)
+        for (PreparedStatementData const& data : stmt->GetParameters())
         {
-            return PreparedStatementData::ToString(data);
-        }, data.data);
+            pos = queryString.find('?', pos);
+
+            std::string replaceStr = std::visit([&](auto&& data)
+            {
+                return PreparedStatementData::ToString(data);
+            }, data.data);
 
-        queryString.replace(pos, 1, replaceStr);
-        pos += replaceStr.length();
+            queryString.replace(pos, 1, replaceStr);
+            pos += replaceStr.length();
+        }
     }
 
     return queryString;
 }
+
+std::string MySQLPreparedStatement::BuildMultiRowInsert(std::string_view query, uint32 rowCount)
+{
+    if (!rowCount || (!StringStartsWithI(query, "INSERT ") && !StringStartsWithI(query, "REPLACE ")))
+        return {};
+
+    // INSERT ... SELECT and similar can not be repeated by appending rows
+    std::size_t valuesPos = std::string_view::npos;
+    for (std::size_t i = 0; i + 6 <= query.length(); ++i)
+    {
+        if (StringEqualI(query.substr(i, 6), "SELECT"))
+            return {};
+
+        if (valuesPos == std::string_view::npos && StringEqualI(query.substr(i, 6), "VALUES"))
+            valuesPos = i;
+    }
+
+    if (valuesPos == std::string_view::npos || query.substr(0, valuesPos).find('?') != std::string_view::npos)
+        return {};
+
+    std::size_t rowBegin = query.find_first_not_of(' ', valuesPos + 6);
+    if (rowBegin == std::string_view::npos || query[rowBegin] != '(')
+        return {};
+
+    // find the end of the row, skipping over nested parentheses and string literals
+    std::size_t rowEnd = std::string_view::npos;
+    uint32 depth = 0;
+    char quote = 0;
+    for (std::size_t i = rowBegin; i < query.length() && rowEnd == std::string_view::npos; ++i)
+    {
+        char c = query[i];
+        if (quote)
+        {
+            if (c == quote)
+                quote = 0;
+        }
+        else if (c == '\'' || c == '"')
+            quote = c;
+        else if (c == '(')
+            ++depth;
+        else if (c == ')' && !--depth)
+            rowEnd = i + 1;
+    }
+
+    // anything after the row (ON DUPLICATE KEY UPDATE, a second row) would change meaning or parameter order
+    if (rowEnd == std::string_view::npos || query.find_first_not_of(' ', rowEnd) != std::string_view::npos)
+        return {};
+
+    std::string_view row = query.substr(rowBegin, rowEnd - rowBegin);
+    std::string multiRowQuery;
+    multiRowQuery.reserve(rowEnd + (row.length() + 2) * (rowCount - 1));
+    multiRowQuery.append(query.substr(0, rowEnd));
+    for (uint32 i = 1; i < rowCount; ++i)
+        multiRowQuery.append(", ").append(row);
+
+    return multiRowQuery;
+}
@@ -22,7 +22,9 @@
 #include "Define.h"
 #include "Duration.h"
 #include "MySQLWorkaround.h"
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 
 class MySQLConnection;
@@ -41,28 +43,41 @@ class TC_DATABASE_API MySQLPreparedStatement
         ~MySQLPreparedStatement();
 
         void BindParameters(PreparedStatementBase* stmt);
+        //- Binds the parameters of several executions of a single row statement
+        //- to the rows of a statement built with BuildMultiRowInsert
+        void BindParameters(std::span<PreparedStatementBase* const> stmts);
 
         uint32 GetParameterCount() const { return m_paramCount; }
+        std::string const& GetQueryString() const { return m_queryString; }
+
+        //- True for plain single row INSERT/REPLACE ... VALUES (...) statements
+        bool IsMultiRowInsertable() const { return m_multiRowInsertable; }
+
+        //- Repeats the VALUES row of a single row INSERT/REPLACE statement rowCount times
+        //- returns an empty string if the statement cannot insert multiple rows this way
+        static std::string BuildMultiRowInsert(std::string_view query, uint32 rowCount);
 
     protected:
-        void SetParameter(uint8 index, std::nullptr_t);
-        void SetParameter(uint8 index, bool value);
+        void SetParameter(uint32 index, std::nullptr_t);
+        void SetParameter(uint32 index, bool value);
         template<typename T>
-        void SetParameter(uint8 index, T value);
-        void SetParameter(uint8 index, SystemTimePoint value);
-        void SetParameter(uint8 index, std::string const& value);
-        void SetParameter(uint8 index, std::vector<uint8> const& value);
+        void SetParameter(uint32 index, T value);
+        void SetParameter(uint32 index, SystemTimePoint value);
+        void SetParameter(uint32 index, std::string const& value);
+        void SetParameter(uint32 index, std::vector<uint8> const& value);
 
         MySQLStmt* GetSTMT() { return m_Mstmt; }
         MySQLBind* GetBind() { return m_bind; }
         PreparedStatementBase* m_stmt;
         void ClearParameters();
-        void AssertValidIndex(uint8 index);
+        void AssertValidIndex(uint32 index);
         std::string getQueryString() const;
 
     private:
         MySQLStmt* m_Mstmt;
+        std::span<PreparedStatementBase* const> m_boundStmts;
         uint32 m_paramCount;
+        bool m_multiRowInsertable;
         std::vector<bool> m_paramsSet;
         MySQLBind* m_bind;
         std::string const m_queryString;
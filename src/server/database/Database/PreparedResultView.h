@@ -0,0 +1,150 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_DATABASE_PREPARED_RESULT_VIEW_H
+#define TRINITY_DATABASE_PREPARED_RESULT_VIEW_H
+
+#include "Errors.h"
+#include "Field.h"
+#include "QueryResult.h"
+#include <cstring>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace Trinity::Impl
+{
+    template<typename T>
+    struct PreparedResultColumnType;
+
+    template<> struct PreparedResultColumnType<uint8> { static constexpr DatabaseFieldTypes Type = DatabaseFieldTypes::UInt8; };
+    template<> struct PreparedResultColumnType<int8> { static constexpr DatabaseFieldTypes Type = DatabaseFieldTypes::Int8; };
+    template<> struct PreparedResultColumnType<uint16> { static constexpr DatabaseFieldTypes Type = DatabaseFieldTypes::UInt16; };
+    template<> struct PreparedResultColumnType<int16> { static constexpr DatabaseFieldTypes Type = DatabaseFieldTypes::Int16; };
+    template<> struct PreparedResultColumnType<uint32> { static constexpr DatabaseFieldTypes Type = DatabaseFieldTypes::UInt32; };
+    template<> struct PreparedResultColumnType<int32> { static constexpr DatabaseFieldTypes Type = DatabaseFieldTypes::Int32; };
+    template<> struct PreparedResultColumnType<uint64> { static constexpr DatabaseFieldTypes Type = DatabaseFieldTypes::UInt64; };
+    template<> struct PreparedResultColumnType<int64> { static constexpr DatabaseFieldTypes Type = DatabaseFieldTypes::Int64; };
+    template<> struct PreparedResultColumnType<float> { static constexpr DatabaseFieldTypes Type = DatabaseFieldTypes::Float; };
+    template<> struct PreparedResultColumnType<double> { static constexpr DatabaseFieldTypes Type = DatabaseFieldTypes::Double; };
+    template<> struct PreparedResultColumnType<std::string_view> { static constexpr DatabaseFieldTypes Type = DatabaseFieldTypes::Binary; };
+}
+
+/**
+    @class PreparedResultView
+
+    @brief Typed read only view over the rows of a PreparedResultSet
+
+    The column types are declared once by the loader and checked against the result metadata when the view is created,
+    row accessors then read values straight from the result buffer without going through Field and its converters.
+    Types must match the column exactly (see the table in Field.h), string and binary columns are read as std::string_view.
+    NULL values read as 0 or an empty string, like Field does.
+
+    @code
+    for (PreparedResultView<uint32, float>::Row row : PreparedResultView<uint32, float>(*result))
+        store[row.Get<0>()] = row.Get<1>();
+    @endcode
+*/
+template<typename... Columns>
+class PreparedResultView
+{
+    using ColumnTuple = std::tuple<Columns...>;
+
+    static constexpr uint32 ColumnCount = sizeof...(Columns);
+
+public:
+    class Row
+    {
+        friend class PreparedResultView;
+
+    public:
+        template<std::size_t Index>
+        std::tuple_element_t<Index, ColumnTuple> Get() const
+        {
+            using T = std::tuple_element_t<Index, ColumnTuple>;
+
+            Field const& field = _fields[Index];
+            if constexpr (std::is_same_v<T, std::string_view>)
+                return field._value ? std::string_view(field._value, field._length) : std::string_view();
+            else
+            {
+                T value = T();
+                if (field._value)
+                    memcpy(&value, field._value, sizeof(T));
+                return value;
+            }
+        }
+
+        template<std::size_t Index>
+        bool IsNull() const
+        {
+            static_assert(Index < ColumnCount);
+            return _fields[Index].IsNull();
+        }
+
+    private:
+        explicit Row(Field const* fields) : _fields(fields) { }
+
+        Field const* _fields;
+    };
+
+    class Iterator
+    {
+        friend class PreparedResultView;
+
+    public:
+        Row operator*() const { return Row(_fields); }
+        Iterator& operator++() { _fields += ColumnCount; return *this; }
+        bool operator==(Iterator const& right) const { return _fields == right._fields; }
+        bool operator!=(Iterator const& right) const { return _fields != right._fields; }
+
+    private:
+        explicit Iterator(Field const* fields) : _fields(fields) { }
+
+        Field const* _fields;
+    };
+
+    explicit PreparedResultView(PreparedResultSet const& result) : _begin(result.m_rows.data()), _end(result.m_rows.data() + result.m_rows.size())
+    {
+        ASSERT(result.GetFieldCount() == ColumnCount, "Result has %u columns, the view reads %u", result.GetFieldCount(), ColumnCount);
+        CheckColumnTypes(result, std::index_sequence_for<Columns...>());
+    }
+
+    uint64 GetRowCount() const { return uint64(_end - _begin) / ColumnCount; }
+
+    Iterator begin() const { return Iterator(_begin); }
+    Iterator end() const { return Iterator(_end); }
+
+private:
+    template<std::size_t... Indexes>
+    static void CheckColumnTypes(PreparedResultSet const& result, std::index_sequence<Indexes...>)
+    {
+        (CheckColumnType(result.GetFieldMetadata(Indexes), Trinity::Impl::PreparedResultColumnType<std::tuple_element_t<Indexes, ColumnTuple>>::Type), ...);
+    }
+
+    static void CheckColumnType(QueryResultFieldMetadata const& meta, DatabaseFieldTypes type)
+    {
+        ASSERT(meta.BinaryProtocol && meta.Type == type, "Column %u (%s.%s) of type %s does not match the type declared by the view (%u)",
+            meta.Index, meta.TableAlias, meta.Alias, meta.TypeName, uint32(type));
+    }
+
+    Field const* _begin;
+    Field const* _end;
+};
+
+#endif // TRINITY_DATABASE_PREPARED_RESULT_VIEW_H
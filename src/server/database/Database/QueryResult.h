@@ -54,6 +54,9 @@ class TC_DATABASE_API ResultSet
 
 class TC_DATABASE_API PreparedResultSet
 {
+    template<typename... Columns>
+    friend class PreparedResultView;
+
     public:
         PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint64 rowCount, uint32 fieldCount);
         ~PreparedResultSet();
@@ -25,6 +25,7 @@
 #include "MovementDefines.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
+#include "PreparedResultView.h"
 #include "SpellInfo.h"
 #include "SpellMgr.h"
 #include "Timer.h"
@@ -69,20 +70,23 @@ void SmartAIMgr::LoadSmartAIFromDB()
 
     uint32 count = 0;
 
-    do
-    {
-        Field* fields = result->Fetch();
+    using SmartScriptsView = PreparedResultView<int32, uint8, uint16, uint16, uint8, uint16, uint8, uint16,
+        uint32, uint32, uint32, uint32, uint32,
+        uint8, uint32, uint32, uint32, uint32, uint32, uint32,
+        uint8, uint32, uint32, uint32, uint32, float, float, float, float>;
 
+    for (SmartScriptsView::Row row : SmartScriptsView(*result))
+    {
         SmartScriptHolder temp;
 
-        temp.entryOrGuid = fields[0].GetInt32();
+        temp.entryOrGuid = row.Get<0>();
         if (!temp.entryOrGuid)
         {
             TC_LOG_ERROR("sql.sql", "SmartAIMgr::LoadSmartAIFromDB: invalid entryorguid (0), skipped loading.");
             continue;
         }
 
-        SmartScriptType source_type = (SmartScriptType)fields[1].GetUInt8();
+        SmartScriptType source_type = (SmartScriptType)row.Get<1>();
         if (source_type >= SMART_SCRIPT_TYPE_MAX)
         {
             TC_LOG_ERROR("sql.sql", "SmartAIMgr::LoadSmartAIFromDB: invalid source_type ({}), skipped loading.", uint32(source_type));
@@ -197,36 +201,36 @@ void SmartAIMgr::LoadSmartAIFromDB()
         }
 
         temp.source_type = source_type;
-        temp.event_id = fields[2].GetUInt16();
-        temp.link = fields[3].GetUInt16();
-        temp.event.type = (SMART_EVENT)fields[4].GetUInt8();
-        temp.event.event_phase_mask = fields[5].GetUInt16();
-        temp.event.event_chance = fields[6].GetUInt8();
-        temp.event.event_flags = fields[7].GetUInt16();
-
-        temp.event.raw.param1 = fields[8].GetUInt32();
-        temp.event.raw.param2 = fields[9].GetUInt32();
-        temp.event.raw.param3 = fields[10].GetUInt32();
-        temp.event.raw.param4 = fields[11].GetUInt32();
-        temp.event.raw.param5 = fields[12].GetUInt32();
-
-        temp.action.type = (SMART_ACTION)fields[13].GetUInt8();
-        temp.action.raw.param1 = fields[14].GetUInt32();
-        temp.action.raw.param2 = fields[15].GetUInt32();
-        temp.action.raw.param3 = fields[16].GetUInt32();
-        temp.action.raw.param4 = fields[17].GetUInt32();
-        temp.action.raw.param5 = fields[18].GetUInt32();
-        temp.action.raw.param6 = fields[19].GetUInt32();
-
-        temp.target.type = (SMARTAI_TARGETS)fields[20].GetUInt8();
-        temp.target.raw.param1 = fields[21].GetUInt32();
-        temp.target.raw.param2 = fields[22].GetUInt32();
-        temp.target.raw.param3 = fields[23].GetUInt32();
-        temp.target.raw.param4 = fields[24].GetUInt32();
-        temp.target.x = fields[25].GetFloat();
-        temp.target.y = fields[26].GetFloat();
-        temp.target.z = fields[27].GetFloat();
-        temp.target.o = fields[28].GetFloat();
+        temp.event_id = row.Get<2>();
+        temp.link = row.Get<3>();
+        temp.event.type = (SMART_EVENT)row.Get<4>();
+        temp.event.event_phase_mask = row.Get<5>();
+        temp.event.event_chance = row.Get<6>();
+        temp.event.event_flags = row.Get<7>();
+
+        temp.event.raw.param1 = row.Get<8>();
+        temp.event.raw.param2 = row.Get<9>();
+        temp.event.raw.param3 = row.Get<10>();
+        temp.event.raw.param4 = row.Get<11>();
+        temp.event.raw.param5 = row.Get<12>();
+
+        temp.action.type = (SMART_ACTION)row.Get<13>();
+        temp.action.raw.param1 = row.Get<14>();
+        temp.action.raw.param2 = row.Get<15>();
+        temp.action.raw.param3 = row.Get<16>();
+        temp.action.raw.param4 = row.Get<17>();
+        temp.action.raw.param5 = row.Get<18>();
+        temp.action.raw.param6 = row.Get<19>();
+
+        temp.target.type = (SMARTAI_TARGETS)row.Get<20>();
+        temp.target.raw.param1 = row.Get<21>();
+        temp.target.raw.param2 = row.Get<22>();
+        temp.target.raw.param3 = row.Get<23>();
+        temp.target.raw.param4 = row.Get<24>();
+        temp.target.x = row.Get<25>();
+        temp.target.y = row.Get<26>();
+        temp.target.z = row.Get<27>();
+        temp.target.o = row.Get<28>();
 
         //check target
         if (!IsTargetValid(temp))
@@ -286,7 +290,6 @@ void SmartAIMgr::LoadSmartAIFromDB()
         // store the new event
         mEventMap[source_type][temp.entryOrGuid].push_back(temp);
     }
-    while (result->NextRow());
 
     // Post Loading Validation
     for (SmartAIEventMap& eventmap : mEventMap)
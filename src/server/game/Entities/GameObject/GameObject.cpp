@@ -2731,7 +2731,6 @@ void GameObject::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player co
         return;
 
     bool forcedFlags = GetGoType() == GAMEOBJECT_TYPE_CHEST && GetGOInfo()->chest.groupLootRules && HasLootRecipient();
-    bool targetIsGM = target->IsGameMaster();
 
     ByteBuffer fieldBuffer;
 
@@ -2752,51 +2751,12 @@ void GameObject::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player co
 
             if (index == GAMEOBJECT_DYNAMIC)
             {
-                uint16 dynFlags = 0;
-                int16 pathProgress = -1;
-                switch (GetGoType())
-                {
-                    case GAMEOBJECT_TYPE_QUESTGIVER:
-                        if (ActivateToQuest(target))
-                            dynFlags |= GO_DYNFLAG_LO_ACTIVATE;
-                        break;
-                    case GAMEOBJECT_TYPE_CHEST:
-                    case GAMEOBJECT_TYPE_GOOBER:
-                        if (ActivateToQuest(target))
-                            dynFlags |= GO_DYNFLAG_LO_ACTIVATE | GO_DYNFLAG_LO_SPARKLE;
-                        else if (targetIsGM)
-                            dynFlags |= GO_DYNFLAG_LO_ACTIVATE;
-                        break;
-                    case GAMEOBJECT_TYPE_GENERIC:
-                        if (ActivateToQuest(target))
-                            dynFlags |= GO_DYNFLAG_LO_SPARKLE;
-                        break;
-                    case GAMEOBJECT_TYPE_TRANSPORT:
-                    case GAMEOBJECT_TYPE_MAP_OBJ_TRANSPORT:
-                    {
-                        if (uint32 transportPeriod = GetTransportPeriod())
-                        {
-                            float timer = float(m_goValue.Transport.PathProgress % transportPeriod);
-                            pathProgress = int16(timer / float(transportPeriod) * 65535.0f);
-                        }
-                        break;
-                    }
-                    default:
-                        break;
-                }
-
-                fieldBuffer << uint16(dynFlags);
-                fieldBuffer << int16(pathProgress);
+                uint32 dynamicValue = BuildDynamicUpdateForTarget(target);
+                fieldBuffer << uint16(dynamicValue & 0xFFFF);
+                fieldBuffer << int16(dynamicValue >> 16);
             }
             else if (index == GAMEOBJECT_FLAGS)
-            {
-                uint32 goFlags = m_uint32Values[GAMEOBJECT_FLAGS];
-                if (GetGoType() == GAMEOBJECT_TYPE_CHEST)
-                    if (GetGOInfo()->chest.groupLootRules && !IsLootAllowedFor(target))
-                        goFlags |= GO_FLAG_LOCKED | GO_FLAG_NOT_SELECTABLE;
-
-                fieldBuffer << goFlags;
-            }
+                fieldBuffer << BuildFlagsUpdateForTarget(target);
             else
                 fieldBuffer << m_uint32Values[index];                // other cases
         }
@@ -2806,6 +2766,64 @@ void GameObject::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player co
     data->append(fieldBuffer);
 }
 
+uint32 GameObject::BuildDynamicUpdateForTarget(Player const* target) const
+{
+    uint16 dynFlags = 0;
+    int16 pathProgress = -1;
+    switch (GetGoType())
+    {
+        case GAMEOBJECT_TYPE_QUESTGIVER:
+            if (ActivateToQuest(target))
+                dynFlags |= GO_DYNFLAG_LO_ACTIVATE;
+            break;
+        case GAMEOBJECT_TYPE_CHEST:
+        case GAMEOBJECT_TYPE_GOOBER:
+            if (ActivateToQuest(target))
+                dynFlags |= GO_DYNFLAG_LO_ACTIVATE | GO_DYNFLAG_LO_SPARKLE;
+            else if (target->IsGameMaster())
+                dynFlags |= GO_DYNFLAG_LO_ACTIVATE;
+            break;
+        case GAMEOBJECT_TYPE_GENERIC:
+            if (ActivateToQuest(target))
+                dynFlags |= GO_DYNFLAG_LO_SPARKLE;
+            break;
+        case GAMEOBJECT_TYPE_TRANSPORT:
+        case GAMEOBJECT_TYPE_MAP_OBJ_TRANSPORT:
+        {
+            if (uint32 transportPeriod = GetTransportPeriod())
+            {
+                float timer = float(m_goValue.Transport.PathProgress % transportPeriod);
+                pathProgress = int16(timer / float(transportPeriod) * 65535.0f);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+
+    // low half: dynamic flags, high half: path progress
+    return uint32(dynFlags) | (uint32(uint16(pathProgress)) << 16);
+}
+
+uint32 GameObject::BuildFlagsUpdateForTarget(Player const* target) const
+{
+    uint32 goFlags = m_uint32Values[GAMEOBJECT_FLAGS];
+    if (GetGoType() == GAMEOBJECT_TYPE_CHEST)
+        if (GetGOInfo()->chest.groupLootRules && !IsLootAllowedFor(target))
+            goFlags |= GO_FLAG_LOCKED | GO_FLAG_NOT_SELECTABLE;
+
+    return goFlags;
+}
+
+bool GameObject::GetValuesUpdateShareKey(Player const* target, ValuesUpdateShareKey& key) const
+{
+    if (!WorldObject::GetValuesUpdateShareKey(target, key))
+        return false;
+
+    key.TargetValues = { BuildDynamicUpdateForTarget(target), BuildFlagsUpdateForTarget(target) };
+    return true;
+}
+
 void GameObject::GetRespawnPosition(float &x, float &y, float &z, float* ori /* = nullptr*/) const
 {
     if (m_goData)
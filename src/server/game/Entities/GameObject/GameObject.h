@@ -89,6 +89,9 @@ class TC_GAME_API GameObject : public WorldObject, public GridObject<GameObject>
         ~GameObject();
 
         void BuildValuesUpdate(uint8 updatetype, ByteBuffer* data, Player const* target) const override;
+        bool GetValuesUpdateShareKey(Player const* target, ValuesUpdateShareKey& key) const override;
+        uint32 BuildDynamicUpdateForTarget(Player const* target) const;
+        uint32 BuildFlagsUpdateForTarget(Player const* target) const;
 
         void AddToWorld() override;
         void RemoveFromWorld() override;
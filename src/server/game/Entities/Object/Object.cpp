@@ -492,10 +492,40 @@ void Object::ClearUpdateMask(bool remove)
     }
 }
 
-void Object::BuildFieldsUpdate(Player* player, UpdateDataMapType& data_map) const
+void Object::BuildFieldsUpdate(Player* player, UpdateDataMapType& data_map, ValuesUpdateBlockCache* blockCache /*= nullptr*/) const
 {
     UpdateDataMapType::iterator iter = data_map.try_emplace(player).first;
-    BuildValuesUpdateBlockForPlayer(&iter->second, iter->first);
+
+    ValuesUpdateShareKey key;
+    if (!blockCache || !GetValuesUpdateShareKey(player, key))
+    {
+        BuildValuesUpdateBlockForPlayer(&iter->second, iter->first);
+        return;
+    }
+
+    auto cached = std::find_if(blockCache->begin(), blockCache->end(), [&key](std::pair<ValuesUpdateShareKey, ByteBuffer> const& block)
+    {
+        return block.first == key;
+    });
+
+    if (cached == blockCache->end())
+    {
+        ByteBuffer block;
+        block << uint8(UPDATETYPE_VALUES);
+        block << GetPackGUID();
+        BuildValuesUpdate(UPDATETYPE_VALUES, &block, player);
+        cached = blockCache->emplace(blockCache->end(), key, std::move(block));
+    }
+
+    iter->second.GetBuffer().append(cached->second);
+    iter->second.AddUpdateBlock();
+}
+
+bool Object::GetValuesUpdateShareKey(Player const* target, ValuesUpdateShareKey& key) const
+{
+    uint32* flags = nullptr;
+    key.VisibleFlag = GetUpdateFieldData(target, flags);
+    return true;
 }
 
 uint32 Object::GetUpdateFieldData(Player const* target, uint32*& flags) const
@@ -3497,6 +3527,7 @@ struct WorldObjectChangeAccumulator
     UpdateDataMapType& i_updateDatas;
     WorldObject& i_object;
     GuidSet plr_list;
+    ValuesUpdateBlockCache i_blockCache;
     WorldObjectChangeAccumulator(WorldObject &obj, UpdateDataMapType &d) : i_updateDatas(d), i_object(obj) { }
     void Visit(PlayerMapType &m)
     {
@@ -3554,7 +3585,7 @@ struct WorldObjectChangeAccumulator
         // Only send update once to a player
         if (plr_list.find(player->GetGUID()) == plr_list.end() && player->HaveAtClient(&i_object))
         {
-            i_object.BuildFieldsUpdate(player, i_updateDatas);
+            i_object.BuildFieldsUpdate(player, i_updateDatas, &i_blockCache);
             plr_list.insert(player->GetGUID());
         }
     }
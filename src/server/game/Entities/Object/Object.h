@@ -33,14 +33,17 @@
 #include "UniqueTrackablePtr.h"
 #include "UpdateFields.h"
 #include "UpdateMask.h"
+#include <array>
 #include <list>
 #include <set>
 #include <unordered_map>
+#include <vector>
 #ifdef ELUNA
 #include "ElunaEventMgr.h"
 #include "LuaValue.h"
 #endif
 
+class ByteBuffer;
 class Corpse;
 class Creature;
 class CreatureAI;
@@ -70,6 +73,18 @@ struct QuaternionData;
 
 typedef std::unordered_map<Player*, UpdateData> UpdateDataMapType;
 
+// Everything about a target that influences the contents of a values update block.
+// Observers with equal keys receive byte-identical blocks, which are then built only once.
+struct ValuesUpdateShareKey
+{
+    uint32 VisibleFlag = 0;
+    std::array<uint32, 2> TargetValues = { };
+
+    friend bool operator==(ValuesUpdateShareKey const& left, ValuesUpdateShareKey const& right) = default;
+};
+
+typedef std::vector<std::pair<ValuesUpdateShareKey, ByteBuffer>> ValuesUpdateBlockCache;
+
 float const DEFAULT_COLLISION_HEIGHT = 2.03128f; // Most common value in dbc
 
 class TC_GAME_API Object
@@ -163,7 +178,7 @@ class TC_GAME_API Object
         virtual bool hasInvolvedQuest(uint32 /* quest_id */) const { return false; }
         void SetIsNewObject(bool enable) { m_isNewObject = enable; }
         virtual void BuildUpdate(UpdateDataMapType&) { }
-        void BuildFieldsUpdate(Player*, UpdateDataMapType &) const;
+        void BuildFieldsUpdate(Player*, UpdateDataMapType &, ValuesUpdateBlockCache* blockCache = nullptr) const;
 
         void SetFieldNotifyFlag(uint16 flag) { _fieldNotifyFlags |= flag; }
         void RemoveFieldNotifyFlag(uint16 flag) { _fieldNotifyFlags &= uint16(~flag); }
@@ -233,6 +248,9 @@ class TC_GAME_API Object
 
         uint32 GetUpdateFieldData(Player const* target, uint32*& flags) const;
 
+        // returns false when the values update for target has to be built specifically for it
+        virtual bool GetValuesUpdateShareKey(Player const* target, ValuesUpdateShareKey& key) const;
+
         void BuildMovementUpdate(ByteBuffer* data, uint16 flags) const;
         virtual void BuildValuesUpdate(uint8 updatetype, ByteBuffer* data, Player const* target) const;
 
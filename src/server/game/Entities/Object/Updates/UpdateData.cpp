@@ -35,29 +35,82 @@ void UpdateData::AddOutOfRangeGUID(ObjectGuid guid)
     m_outOfRangeGUIDs.insert(guid);
 }
 
-void UpdateData::Compress(void* dst, uint32 *dst_size, void* src, int src_size)
+namespace
 {
-    z_stream c_stream;
-
-    c_stream.zalloc = (alloc_func)nullptr;
-    c_stream.zfree = (free_func)nullptr;
-    c_stream.opaque = (voidpf)nullptr;
+    // Deflate stream kept alive for the lifetime of the thread building update packets (map and world threads).
+    // Setting up a stream allocates ~256KB of internal state, deflateReset only rewinds it.
+    class UpdateCompressionStream
+    {
+    public:
+        UpdateCompressionStream() : _level(0), _initialized(false)
+        {
+            _stream.zalloc = (alloc_func)nullptr;
+            _stream.zfree = (free_func)nullptr;
+            _stream.opaque = (voidpf)nullptr;
+        }
+
+        ~UpdateCompressionStream()
+        {
+            if (_initialized)
+                deflateEnd(&_stream);
+        }
+
+        UpdateCompressionStream(UpdateCompressionStream const&) = delete;
+        UpdateCompressionStream& operator=(UpdateCompressionStream const&) = delete;
+
+        z_stream* Acquire(int level)
+        {
+            if (_initialized && _level == level)
+            {
+                int z_res = deflateReset(&_stream);
+                if (z_res == Z_OK)
+                    return &_stream;
+
+                TC_LOG_ERROR("misc", "Can't compress update packet (zlib: deflateReset) Error code: {} ({})", z_res, zError(z_res));
+            }
+
+            if (_initialized)
+            {
+                deflateEnd(&_stream);
+                _initialized = false;
+            }
+
+            int z_res = deflateInit(&_stream, level);
+            if (z_res != Z_OK)
+            {
+                TC_LOG_ERROR("misc", "Can't compress update packet (zlib: deflateInit) Error code: {} ({})", z_res, zError(z_res));
+                return nullptr;
+            }
+
+            _level = level;
+            _initialized = true;
+            return &_stream;
+        }
+
+    private:
+        z_stream _stream;
+        int _level;
+        bool _initialized;
+    };
+
+    thread_local UpdateCompressionStream CompressionStream;
+}
 
-    // default Z_BEST_SPEED (1)
-    int z_res = deflateInit(&c_stream, sWorld->getIntConfig(CONFIG_COMPRESSION));
-    if (z_res != Z_OK)
+void UpdateData::Compress(void* dst, uint32 *dst_size, void const* src, int src_size, int level)
+{
+    z_stream* c_stream = CompressionStream.Acquire(level);
+    if (!c_stream)
     {
-        TC_LOG_ERROR("misc", "Can't compress update packet (zlib: deflateInit) Error code: {} ({})", z_res, zError(z_res));
         *dst_size = 0;
         return;
     }
 
-    c_stream.next_out = (Bytef*)dst;
-    c_stream.avail_out = *dst_size;
-    c_stream.next_in = (Bytef*)src;
-    c_stream.avail_in = (uInt)src_size;
+    c_stream->next_out = (Bytef*)dst;
+    c_stream->avail_out = *dst_size;
+    c_stream->next_in = (Bytef*)src;
+    c_stream->avail_in = (uInt)src_size;
 
-    z_res = deflate(&c_stream, Z_NO_FLUSH);
+    int z_res = deflate(c_stream, Z_NO_FLUSH);
     if (z_res != Z_OK)
     {
         TC_LOG_ERROR("misc", "Can't compress update packet (zlib: deflate) Error code: {} ({})", z_res, zError(z_res));
@@ -65,14 +118,14 @@ void UpdateData::Compress(void* dst, uint32 *dst_size, void* src, int src_size)
         return;
     }
 
-    if (c_stream.avail_in != 0)
+    if (c_stream->avail_in != 0)
     {
         TC_LOG_ERROR("misc", "Can't compress update packet (zlib: deflate not greedy)");
         *dst_size = 0;
         return;
     }
 
-    z_res = deflate(&c_stream, Z_FINISH);
+    z_res = deflate(c_stream, Z_FINISH);
     if (z_res != Z_STREAM_END)
     {
         TC_LOG_ERROR("misc", "Can't compress update packet (zlib: deflate should report Z_STREAM_END instead {} ({})", z_res, zError(z_res));
@@ -80,15 +133,7 @@ void UpdateData::Compress(void* dst, uint32 *dst_size, void* src, int src_size)
         return;
     }
 
-    z_res = deflateEnd(&c_stream);
-    if (z_res != Z_OK)
-    {
-        TC_LOG_ERROR("misc", "Can't compress update packet (zlib: deflateEnd) Error code: {} ({})", z_res, zError(z_res));
-        *dst_size = 0;
-        return;
-    }
-
-    *dst_size = c_stream.total_out;
+    *dst_size = c_stream->total_out;
 }
 
 bool UpdateData::BuildPacket(WorldPacket* packet)
@@ -112,13 +157,14 @@ bool UpdateData::BuildPacket(WorldPacket* packet)
 
     size_t pSize = buf.wpos();                              // use real used data size
 
-    if (pSize > 100)                                       // compress large packets
+    if (pSize > sWorld->getIntConfig(CONFIG_COMPRESSION_THRESHOLD)) // compress large packets
     {
         uint32 destsize = compressBound(pSize);
         packet->resize(destsize + sizeof(uint32));
 
         packet->put<uint32>(0, pSize);
-        Compress(const_cast<uint8*>(packet->contents()) + sizeof(uint32), &destsize, (void*)buf.contents(), pSize);
+        // default Z_BEST_SPEED (1)
+        Compress(const_cast<uint8*>(packet->contents()) + sizeof(uint32), &destsize, buf.contents(), pSize, sWorld->getIntConfig(CONFIG_COMPRESSION));
         if (destsize == 0)
             return false;
 
@@ -188,6 +188,9 @@ Player::Player(WorldSession* session): Unit(true)
     PlayerTalkClass = new PlayerMenu(GetSession());
     m_currentBuybackSlot = BUYBACK_SLOT_START;
 
+    m_aurasSaved = false;
+    m_glyphsChanged = true;
+
     m_DailyQuestChanged = false;
     m_lastDailyQuestTime = 0;
 
@@ -306,6 +309,7 @@ Player::Player(WorldSession* session): Unit(true)
 
     m_grantableLevels = 0;
     m_fishingSteps = 0;
+    m_savedFishingSteps = 0;
 
     m_ControlledByPlayer = true;
 
@@ -6198,6 +6202,11 @@ void Player::SendDirectMessage(WorldPacket const* data) const
     m_session->SendPacket(data);
 }
 
+void Player::SendDirectMessage(std::shared_ptr<WorldPacket const> const& data) const
+{
+    m_session->SendPacket(data);
+}
+
 void Player::SendCinematicStart(uint32 CinematicSequenceId) const
 {
     WorldPackets::Misc::TriggerCinematic packet;
@@ -17104,6 +17113,7 @@ bool Player::LoadFromDB(ObjectGuid guid, CharacterDatabaseQueryHolder const& hol
     SetByteValue(PLAYER_FIELD_BYTES, PLAYER_FIELD_BYTES_OFFSET_ACTION_BAR_TOGGLES, fields[70].GetUInt8());
 
     m_fishingSteps = fields[72].GetUInt8();
+    m_savedFishingSteps = m_fishingSteps;
 
     InitDisplayIds();
 
@@ -19122,10 +19132,6 @@ void Player::SaveToDB(CharacterDatabaseTransaction trans, bool create /* = false
     CharacterDatabasePreparedStatement* stmt = nullptr;
     uint8 index = 0;
 
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_FISHINGSTEPS);
-    stmt->setUInt32(0, GetGUID().GetCounter());
-    trans->Append(stmt);
-
     auto finiteAlways = [](float f) { return std::isfinite(f) ? f : 0.0f; };
 
     if (create)
@@ -19373,13 +19379,22 @@ void Player::SaveToDB(CharacterDatabaseTransaction trans, bool create /* = false
 
     trans->Append(stmt);
 
-    if (m_fishingSteps != 0)
+    if (m_fishingSteps != m_savedFishingSteps)
     {
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHAR_FISHINGSTEPS);
-        index = 0;
-        stmt->setUInt32(index++, GetGUID().GetCounter());
-        stmt->setUInt32(index++, m_fishingSteps);
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_FISHINGSTEPS);
+        stmt->setUInt32(0, GetGUID().GetCounter());
         trans->Append(stmt);
+
+        if (m_fishingSteps != 0)
+        {
+            stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHAR_FISHINGSTEPS);
+            index = 0;
+            stmt->setUInt32(index++, GetGUID().GetCounter());
+            stmt->setUInt32(index++, m_fishingSteps);
+            trans->Append(stmt);
+        }
+
+        m_savedFishingSteps = m_fishingSteps;
     }
 
     if (m_mailsUpdated)                                     //save mails only when needed
@@ -19480,10 +19495,20 @@ void Player::_SaveActions(CharacterDatabaseTransaction trans)
 
 void Player::_SaveAuras(CharacterDatabaseTransaction trans)
 {
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_AURA);
-    stmt->setUInt32(0, GetGUID().GetCounter());
-    trans->Append(stmt);
+    CharacterDatabasePreparedStatement* stmt;
 
+    // the first save rewrites all auras, afterwards only auras that changed since the last save are written
+    if (!m_aurasSaved)
+    {
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_AURA);
+        stmt->setUInt32(0, GetGUID().GetCounter());
+        trans->Append(stmt);
+
+        m_savedAuras.clear();
+        m_aurasSaved = true;
+    }
+
+    SavedAuraMap savedAuras;
     for (AuraMap::const_iterator itr = m_ownedAuras.begin(); itr != m_ownedAuras.end(); ++itr)
     {
         if (!itr->second->CanBeSaved())
@@ -19491,49 +19516,79 @@ void Player::_SaveAuras(CharacterDatabaseTransaction trans)
 
         Aura* aura = itr->second;
 
-        int32 damage[MAX_SPELL_EFFECTS];
-        int32 baseDamage[MAX_SPELL_EFFECTS];
+        SavedAuraData data;
         uint8 effMask = 0;
-        uint8 recalculateMask = 0;
+        data.RecalculateMask = 0;
         for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
         {
             if (AuraEffect const* effect = aura->GetEffect(i))
             {
-                baseDamage[i] = effect->GetBaseAmount();
-                damage[i] = effect->GetAmount();
+                data.BaseAmount[i] = effect->GetBaseAmount();
+                data.Amount[i] = effect->GetAmount();
                 effMask |= 1 << i;
                 if (effect->CanBeRecalculated())
-                    recalculateMask |= 1 << i;
+                    data.RecalculateMask |= 1 << i;
             }
             else
             {
-                baseDamage[i] = 0;
-                damage[i] = 0;
+                data.BaseAmount[i] = 0;
+                data.Amount[i] = 0;
             }
         }
 
+        data.StackAmount = aura->GetStackAmount();
+        data.MaxDuration = aura->GetMaxDuration();
+        data.Duration = aura->GetDuration();
+        data.Charges = aura->GetCharges();
+        data.CritChance = aura->GetCritChance();
+        data.ApplyResilience = aura->CanApplyResilience();
+
+        auto key = std::make_tuple(aura->GetCasterGUID(), aura->GetCastItemGUID(), aura->GetId(), effMask);
+        savedAuras[key] = data;
+
+        auto saved = m_savedAuras.find(key);
+        if (saved != m_savedAuras.end() && saved->second == data)
+            continue;
+
         uint8 index = 0;
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_AURA);
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_AURA);
         stmt->setUInt32(index++, GetGUID().GetCounter());
-        stmt->setUInt64(index++, itr->second->GetCasterGUID().GetRawValue());
-        stmt->setUInt64(index++, itr->second->GetCastItemGUID().GetRawValue());
-        stmt->setUInt32(index++, itr->second->GetId());
+        stmt->setUInt64(index++, aura->GetCasterGUID().GetRawValue());
+        stmt->setUInt64(index++, aura->GetCastItemGUID().GetRawValue());
+        stmt->setUInt32(index++, aura->GetId());
         stmt->setUInt8(index++, effMask);
-        stmt->setUInt8(index++, recalculateMask);
-        stmt->setUInt8(index++, itr->second->GetStackAmount());
-        stmt->setInt32(index++, damage[0]);
-        stmt->setInt32(index++, damage[1]);
-        stmt->setInt32(index++, damage[2]);
-        stmt->setInt32(index++, baseDamage[0]);
-        stmt->setInt32(index++, baseDamage[1]);
-        stmt->setInt32(index++, baseDamage[2]);
-        stmt->setInt32(index++, itr->second->GetMaxDuration());
-        stmt->setInt32(index++, itr->second->GetDuration());
-        stmt->setUInt8(index++, itr->second->GetCharges());
-        stmt->setFloat(index++, itr->second->GetCritChance());
-        stmt->setBool (index++, itr->second->CanApplyResilience());
+        stmt->setUInt8(index++, data.RecalculateMask);
+        stmt->setUInt8(index++, data.StackAmount);
+        stmt->setInt32(index++, data.Amount[0]);
+        stmt->setInt32(index++, data.Amount[1]);
+        stmt->setInt32(index++, data.Amount[2]);
+        stmt->setInt32(index++, data.BaseAmount[0]);
+        stmt->setInt32(index++, data.BaseAmount[1]);
+        stmt->setInt32(index++, data.BaseAmount[2]);
+        stmt->setInt32(index++, data.MaxDuration);
+        stmt->setInt32(index++, data.Duration);
+        stmt->setUInt8(index++, data.Charges);
+        stmt->setFloat(index++, data.CritChance);
+        stmt->setBool (index++, data.ApplyResilience);
+        trans->Append(stmt);
+    }
+
+    // auras saved last time that are gone now
+    for (SavedAuraMap::const_iterator itr = m_savedAuras.begin(); itr != m_savedAuras.end(); ++itr)
+    {
+        if (savedAuras.count(itr->first))
+            continue;
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_AURA_BY_SPELL);
+        stmt->setUInt32(0, GetGUID().GetCounter());
+        stmt->setUInt64(1, std::get<0>(itr->first).GetRawValue());
+        stmt->setUInt64(2, std::get<1>(itr->first).GetRawValue());
+        stmt->setUInt32(3, std::get<2>(itr->first));
+        stmt->setUInt8(4, std::get<3>(itr->first));
         trans->Append(stmt);
     }
+
+    m_savedAuras = std::move(savedAuras);
 }
 
 void Player::_SaveInventory(CharacterDatabaseTransaction trans)
@@ -24413,6 +24468,9 @@ void Player::InitGlyphsForLevel()
 
 void Player::SetGlyph(uint8 slot, uint32 glyph)
 {
+    if (_talentMgr->SpecInfo[GetActiveSpec()].Glyphs[slot] != glyph)
+        m_glyphsChanged = true;
+
     _talentMgr->SpecInfo[GetActiveSpec()].Glyphs[slot] = glyph;
     SetUInt32Value(PLAYER_FIELD_GLYPHS_1 + slot, glyph);
 }
@@ -25712,6 +25770,15 @@ void Player::_SaveEquipmentSets(CharacterDatabaseTransaction trans)
 
 void Player::_SaveBGData(CharacterDatabaseTransaction trans)
 {
+    // entry point data only changes when joining or leaving a battleground
+    if (m_savedBGData && m_savedBGData->bgInstanceID == m_bgData.bgInstanceID && m_savedBGData->bgTeam == m_bgData.bgTeam
+        && m_savedBGData->joinPos.GetMapId() == m_bgData.joinPos.GetMapId() && m_savedBGData->joinPos == m_bgData.joinPos
+        && m_savedBGData->taxiPath[0] == m_bgData.taxiPath[0] && m_savedBGData->taxiPath[1] == m_bgData.taxiPath[1]
+        && m_savedBGData->mountSpell == m_bgData.mountSpell)
+        return;
+
+    m_savedBGData = m_bgData;
+
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PLAYER_BGDATA);
     stmt->setUInt32(0, GetGUID().GetCounter());
     trans->Append(stmt);
@@ -25783,6 +25850,7 @@ void Player::SetMap(Map* map)
 void Player::_LoadGlyphs(PreparedQueryResult result)
 {
     // SELECT talentGroup, glyph1, glyph2, glyph3, glyph4, glyph5, glyph6 from character_glyphs WHERE guid = '%u'
+    m_glyphsChanged = false;
     if (!result)
         return;
 
@@ -25792,7 +25860,10 @@ void Player::_LoadGlyphs(PreparedQueryResult result)
 
         uint8 spec = fields[0].GetUInt8();
         if (spec >= GetSpecsCount())
+        {
+            m_glyphsChanged = true;                         // rewrite on next save to drop the stale row
             continue;
+        }
 
         for (uint8 i = 0; i < MAX_GLYPH_SLOT_INDEX; ++i)
             _talentMgr->SpecInfo[spec].Glyphs[i] = fields[i + 1].GetUInt16();
@@ -25800,8 +25871,13 @@ void Player::_LoadGlyphs(PreparedQueryResult result)
     while (result->NextRow());
 }
 
-void Player::_SaveGlyphs(CharacterDatabaseTransaction trans) const
+void Player::_SaveGlyphs(CharacterDatabaseTransaction trans)
 {
+    if (!m_glyphsChanged)
+        return;
+
+    m_glyphsChanged = false;
+
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_GLYPHS);
     stmt->setUInt32(0, GetGUID().GetCounter());
     trans->Append(stmt);
@@ -862,6 +862,25 @@ struct BGData
     bool HasTaxiPath() const { return taxiPath[0] && taxiPath[1]; }
 };
 
+// character_aura row as written by the last save, used to skip unchanged auras on the next one
+struct SavedAuraData
+{
+    uint8 RecalculateMask;
+    uint8 StackAmount;
+    std::array<int32, MAX_SPELL_EFFECTS> Amount;
+    std::array<int32, MAX_SPELL_EFFECTS> BaseAmount;
+    int32 MaxDuration;
+    int32 Duration;
+    uint8 Charges;
+    float CritChance;
+    bool ApplyResilience;
+
+    bool operator==(SavedAuraData const& right) const = default;
+};
+
+// caster guid, cast item guid, spell id, effect mask - the primary key of character_aura
+typedef std::map<std::tuple<ObjectGuid, ObjectGuid, uint32, uint8>, SavedAuraData> SavedAuraMap;
+
 struct TradeStatusInfo
 {
     TradeStatusInfo() : Status(TRADE_STATUS_BUSY), TraderGuid(), Result(EQUIP_ERR_OK),
@@ -1503,7 +1522,7 @@ class TC_GAME_API Player : public Unit, public GridObject<Player>
         uint8 GetActiveSpec() const { return _talentMgr->ActiveSpec; }
         void SetActiveSpec(uint8 spec){ _talentMgr->ActiveSpec = spec; }
         uint8 GetSpecsCount() const { return _talentMgr->SpecsCount; }
-        void SetSpecsCount(uint8 count) { _talentMgr->SpecsCount = count; }
+        void SetSpecsCount(uint8 count) { _talentMgr->SpecsCount = count; m_glyphsChanged = true; }
 
         bool ResetTalents(bool involuntarily = false);
         uint32 ResetTalentsCost() const;
@@ -1966,6 +1985,7 @@ class TC_GAME_API Player : public Unit, public GridObject<Player>
         void SendInitWorldStates(uint32 zoneId, uint32 areaId);
         void SendUpdateWorldState(uint32 variable, uint32 value) const;
         void SendDirectMessage(WorldPacket const* data) const;
+        void SendDirectMessage(std::shared_ptr<WorldPacket const> const& data) const;
         void SendBGWeekendWorldStates() const;
         void SendBattlefieldWorldStates() const;
 
@@ -2355,7 +2375,7 @@ class TC_GAME_API Player : public Unit, public GridObject<Player>
         void _SaveSpells(CharacterDatabaseTransaction trans);
         void _SaveEquipmentSets(CharacterDatabaseTransaction trans);
         void _SaveBGData(CharacterDatabaseTransaction trans);
-        void _SaveGlyphs(CharacterDatabaseTransaction trans) const;
+        void _SaveGlyphs(CharacterDatabaseTransaction trans);
         void _SaveTalents(CharacterDatabaseTransaction trans);
         void _SaveStats(CharacterDatabaseTransaction trans) const;
 
@@ -2439,6 +2459,12 @@ class TC_GAME_API Player : public Unit, public GridObject<Player>
 
         TradeData* m_trade;
 
+        // state of the last save, only subsystems that rewrite all their rows need these
+        SavedAuraMap m_savedAuras;
+        bool m_aurasSaved;
+        Optional<BGData> m_savedBGData;
+        bool m_glyphsChanged;
+
         bool   m_DailyQuestChanged;
         bool   m_WeeklyQuestChanged;
         bool   m_MonthlyQuestChanged;
@@ -2506,6 +2532,7 @@ class TC_GAME_API Player : public Unit, public GridObject<Player>
         uint8 m_grantableLevels;
 
         uint8 m_fishingSteps;
+        uint8 m_savedFishingSteps;
 
         bool m_needsZoneUpdate;
 
@@ -9587,6 +9587,7 @@ void Unit::AddToWorld()
 
     WorldObject::AddToWorld();
     i_motionMaster->AddToWorld();
+    GetMap()->GetUnitPositionIndex().Insert(this);
 }
 
 void Unit::RemoveFromWorld()
@@ -9633,6 +9634,7 @@ void Unit::RemoveFromWorld()
             }
         }
 
+        GetMap()->GetUnitPositionIndex().Remove(this);
         WorldObject::RemoveFromWorld();
         m_duringRemoveFromWorld = false;
     }
@@ -13620,13 +13622,7 @@ void Unit::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player const* t
 
             if (index == UNIT_NPC_FLAGS)
             {
-                uint32 appendValue = m_uint32Values[UNIT_NPC_FLAGS];
-
-                if (creature)
-                    if (!target->CanSeeSpellClickOn(creature))
-                        appendValue &= ~UNIT_NPC_FLAG_SPELLCLICK;
-
-                fieldBuffer << uint32(appendValue);
+                fieldBuffer << BuildNpcFlagsUpdateForTarget(target);
             }
             else if (index == UNIT_FIELD_AURASTATE)
             {
@@ -13690,27 +13686,7 @@ void Unit::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player const* t
             // hide lootable animation for unallowed players
             else if (index == UNIT_DYNAMIC_FLAGS)
             {
-                uint32 dynamicFlags = m_uint32Values[UNIT_DYNAMIC_FLAGS] & ~(UNIT_DYNFLAG_TAPPED | UNIT_DYNFLAG_TAPPED_BY_PLAYER);
-
-                if (creature)
-                {
-                    if (creature->hasLootRecipient())
-                    {
-                        dynamicFlags |= UNIT_DYNFLAG_TAPPED;
-                        if (creature->isTappedBy(target))
-                            dynamicFlags |= UNIT_DYNFLAG_TAPPED_BY_PLAYER;
-                    }
-
-                    if (!target->isAllowedToLoot(creature))
-                        dynamicFlags &= ~UNIT_DYNFLAG_LOOTABLE;
-                }
-
-                // unit UNIT_DYNFLAG_TRACK_UNIT should only be sent to caster of SPELL_AURA_MOD_STALKED auras
-                if (dynamicFlags & UNIT_DYNFLAG_TRACK_UNIT)
-                    if (!HasAuraTypeWithCaster(SPELL_AURA_MOD_STALKED, target->GetGUID()))
-                        dynamicFlags &= ~UNIT_DYNFLAG_TRACK_UNIT;
-
-                fieldBuffer << dynamicFlags;
+                fieldBuffer << BuildDynamicFlagsUpdateForTarget(target);
             }
             // FG: pretend that OTHER players in own group are friendly ("blue")
             else if (index == UNIT_FIELD_BYTES_2 || index == UNIT_FIELD_FACTIONTEMPLATE)
@@ -13746,6 +13722,64 @@ void Unit::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player const* t
     data->append(fieldBuffer);
 }
 
+uint32 Unit::BuildNpcFlagsUpdateForTarget(Player const* target) const
+{
+    uint32 npcFlags = m_uint32Values[UNIT_NPC_FLAGS];
+
+    if (Creature const* creature = ToCreature())
+        if (!target->CanSeeSpellClickOn(creature))
+            npcFlags &= ~UNIT_NPC_FLAG_SPELLCLICK;
+
+    return npcFlags;
+}
+
+uint32 Unit::BuildDynamicFlagsUpdateForTarget(Player const* target) const
+{
+    uint32 dynamicFlags = m_uint32Values[UNIT_DYNAMIC_FLAGS] & ~(UNIT_DYNFLAG_TAPPED | UNIT_DYNFLAG_TAPPED_BY_PLAYER);
+
+    if (Creature const* creature = ToCreature())
+    {
+        if (creature->hasLootRecipient())
+        {
+            dynamicFlags |= UNIT_DYNFLAG_TAPPED;
+            if (creature->isTappedBy(target))
+                dynamicFlags |= UNIT_DYNFLAG_TAPPED_BY_PLAYER;
+        }
+
+        if (!target->isAllowedToLoot(creature))
+            dynamicFlags &= ~UNIT_DYNFLAG_LOOTABLE;
+    }
+
+    // unit UNIT_DYNFLAG_TRACK_UNIT should only be sent to caster of SPELL_AURA_MOD_STALKED auras
+    if (dynamicFlags & UNIT_DYNFLAG_TRACK_UNIT)
+        if (!HasAuraTypeWithCaster(SPELL_AURA_MOD_STALKED, target->GetGUID()))
+            dynamicFlags &= ~UNIT_DYNFLAG_TRACK_UNIT;
+
+    return dynamicFlags;
+}
+
+bool Unit::GetValuesUpdateShareKey(Player const* target, ValuesUpdateShareKey& key) const
+{
+    // flags and display id are rewritten for gamemasters
+    if (target->IsGameMaster())
+        return false;
+
+    // per caster aura states
+    if (_changesMask.GetBit(UNIT_FIELD_AURASTATE) || HasFlag(UNIT_FIELD_AURASTATE, PER_CASTER_AURA_STATE_MASK))
+        return false;
+
+    // faction is faked for raid members of the opposite faction
+    if (IsControlledByPlayer() && (_changesMask.GetBit(UNIT_FIELD_BYTES_2) || _changesMask.GetBit(UNIT_FIELD_FACTIONTEMPLATE)))
+        return false;
+
+    if (!WorldObject::GetValuesUpdateShareKey(target, key))
+        return false;
+
+    // always sent (UF_FLAG_DYNAMIC) and depend on who looks at the unit
+    key.TargetValues = { BuildNpcFlagsUpdateForTarget(target), BuildDynamicFlagsUpdateForTarget(target) };
+    return true;
+}
+
 void Unit::DestroyForPlayer(Player* target, bool onDeath) const
 {
     if (Battleground* bg = target->GetBattleground())
@@ -1834,6 +1834,9 @@ class TC_GAME_API Unit : public WorldObject
         explicit Unit (bool isWorldObject);
 
         void BuildValuesUpdate(uint8 updatetype, ByteBuffer* data, Player const* target) const override;
+        bool GetValuesUpdateShareKey(Player const* target, ValuesUpdateShareKey& key) const override;
+        uint32 BuildNpcFlagsUpdateForTarget(Player const* target) const;
+        uint32 BuildDynamicFlagsUpdateForTarget(Player const* target) const;
         void DestroyForPlayer(Player* target, bool onDeath) const override;
 
         void _UpdateSpells(uint32 time);
@@ -19,6 +19,7 @@
 #define TRINITY_OBJECTACCESSOR_H
 
 #include "ObjectGuid.h"
+#include "ShardedMap.h"
 #include <shared_mutex>
 #include <unordered_map>
 
@@ -43,6 +44,7 @@ class TC_GAME_API HashMapHolder
 public:
 
     typedef std::unordered_map<ObjectGuid, T*> MapType;
+    typedef Trinity::Containers::ShardedMap<ObjectGuid, T*> LookupType;
 
     static void Insert(T* o);
 
@@ -53,6 +55,9 @@ public:
     static MapType& GetContainer();
 
     static std::shared_mutex* GetLock();
+
+private:
+    static LookupType& GetLookup();
 };
 
 namespace ObjectAccessor
@@ -0,0 +1,93 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GridPreloader.h"
+#include "GameTime.h"
+#include "MapTree.h"
+#include "Metric.h"
+#include "StringFormat.h"
+#include "ThreadPool.h"
+#include "World.h"
+#include <array>
+#include <cstdio>
+
+namespace
+{
+    // a tile is not queued again for this long, whether or not the grid got loaded meanwhile
+    constexpr Seconds PrefetchRepeatDelay(60);
+
+    uint32 MakeTileKey(uint32 mapId, uint32 gx, uint32 gy)
+    {
+        return (mapId << 12) | (gx << 6) | gy;
+    }
+
+    void ReadWholeFile(std::string const& fileName)
+    {
+        FILE* file = fopen(fileName.c_str(), "rb");
+        if (!file)
+            return;
+
+        std::array<char, 64 * 1024> buffer;
+        while (fread(buffer.data(), 1, buffer.size(), file) == buffer.size())
+            ;
+
+        fclose(file);
+    }
+}
+
+GridPreloader::GridPreloader() = default;
+GridPreloader::~GridPreloader() = default;
+
+GridPreloader* GridPreloader::instance()
+{
+    static GridPreloader instance;
+    return &instance;
+}
+
+void GridPreloader::Prefetch(uint32 mapId, uint32 gx, uint32 gy)
+{
+    uint32 key = MakeTileKey(mapId, gx, gy);
+    TimePoint now = GameTime::Now();
+
+    std::lock_guard<std::mutex> lock(_lock);
+    auto [itr, inserted] = _requested.try_emplace(key, now);
+    if (!inserted)
+    {
+        if (now - itr->second < PrefetchRepeatDelay)
+            return;
+
+        itr->second = now;
+    }
+
+    if (!_pool)
+        _pool = std::make_unique<Trinity::ThreadPool>(1);
+
+    _pool->PostWork([this, mapId, gx, gy]()
+    {
+        ReadTileFiles(mapId, gx, gy);
+    });
+}
+
+void GridPreloader::ReadTileFiles(uint32 mapId, uint32 gx, uint32 gy)
+{
+    TC_METRIC_TIMER("map_grid_prefetch_time", TC_METRIC_TAG("map_id", std::to_string(mapId)));
+
+    std::string const& dataPath = sWorld->GetDataPath();
+    ReadWholeFile(Trinity::StringFormat("{}maps/{:03}{:02}{:02}.map", dataPath, mapId, gx, gy));
+    ReadWholeFile(dataPath + "vmaps/" + VMAP::StaticMapTree::getTileFileName(mapId, gx, gy));
+    ReadWholeFile(Trinity::StringFormat("{}mmaps/{:03}{:02}{:02}.mmtile", dataPath, mapId, gx, gy));
+}
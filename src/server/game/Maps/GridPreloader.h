@@ -0,0 +1,59 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_GRID_PRELOADER_H
+#define TRINITYCORE_GRID_PRELOADER_H
+
+#include "Define.h"
+#include "Duration.h"
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace Trinity
+{
+    class ThreadPool;
+}
+
+/// Reads the terrain, vmap and mmap tile files of grids that players are about to enter
+/// on a background thread, so the synchronous grid load on the map thread finds them in
+/// the OS page cache instead of waiting for the disk.
+class TC_GAME_API GridPreloader
+{
+    GridPreloader();
+    ~GridPreloader();
+
+public:
+    GridPreloader(GridPreloader const&) = delete;
+    GridPreloader& operator=(GridPreloader const&) = delete;
+
+    static GridPreloader* instance();
+
+    /// gx and gy are the tile coordinates used in the data file names
+    void Prefetch(uint32 mapId, uint32 gx, uint32 gy);
+
+private:
+    void ReadTileFiles(uint32 mapId, uint32 gx, uint32 gy);
+
+    std::mutex _lock;
+    std::unique_ptr<Trinity::ThreadPool> _pool;
+    std::unordered_map<uint32 /*tileKey*/, TimePoint /*queuedAt*/> _requested;
+};
+
+#define sGridPreloader GridPreloader::instance()
+
+#endif // TRINITYCORE_GRID_PRELOADER_H
@@ -0,0 +1,81 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LineOfSightCache.h"
+#include "Hash.h"
+#include <cmath>
+
+namespace
+{
+    constexpr float QUANTIZATION_STEPS_PER_YARD = 8.0f;
+
+    // upper bound on remembered pairs per map, the cache starts over once reached
+    constexpr std::size_t MAX_CACHED_RESULTS = 16384;
+
+    int32 Quantize(float c)
+    {
+        return int32(std::floor(c * QUANTIZATION_STEPS_PER_YARD));
+    }
+}
+
+std::size_t LineOfSightCache::KeyHash::operator()(Key const& key) const
+{
+    std::size_t hashVal = 0;
+    for (int32 coord : key.Coords)
+        Trinity::hash_combine(hashVal, coord);
+
+    Trinity::hash_combine(hashVal, key.IgnoreFlags);
+    return hashVal;
+}
+
+LineOfSightCache::Key LineOfSightCache::MakeKey(float x1, float y1, float z1, float x2, float y2, float z2, uint32 ignoreFlags)
+{
+    return { { Quantize(x1), Quantize(y1), Quantize(z1), Quantize(x2), Quantize(y2), Quantize(z2) }, ignoreFlags };
+}
+
+void LineOfSightCache::SyncGeneration(uint32 generation)
+{
+    if (generation == _generation)
+        return;
+
+    _results.clear();
+    _generation = generation;
+}
+
+bool LineOfSightCache::Find(uint32 generation, float x1, float y1, float z1, float x2, float y2, float z2, uint32 ignoreFlags, bool& inLineOfSight)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    SyncGeneration(generation);
+
+    auto itr = _results.find(MakeKey(x1, y1, z1, x2, y2, z2, ignoreFlags));
+    if (itr == _results.end())
+        return false;
+
+    inLineOfSight = itr->second;
+    return true;
+}
+
+void LineOfSightCache::Store(uint32 generation, float x1, float y1, float z1, float x2, float y2, float z2, uint32 ignoreFlags, bool inLineOfSight)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    SyncGeneration(generation);
+
+    if (_results.size() >= MAX_CACHED_RESULTS)
+        _results.clear();
+
+    _results[MakeKey(x1, y1, z1, x2, y2, z2, ignoreFlags)] = inLineOfSight;
+}
@@ -0,0 +1,57 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_LINE_OF_SIGHT_CACHE_H
+#define TRINITYCORE_LINE_OF_SIGHT_CACHE_H
+
+#include "Define.h"
+#include <array>
+#include <mutex>
+#include <unordered_map>
+
+/// Remembers static (vmap) line of sight results between endpoints quantized to 1/8 yard.
+/// Results are tagged with the vmap tile generation of the map and dropped as soon as
+/// tiles are loaded or unloaded, dynamic gameobject collision is never cached.
+class TC_GAME_API LineOfSightCache
+{
+public:
+    bool Find(uint32 generation, float x1, float y1, float z1, float x2, float y2, float z2, uint32 ignoreFlags, bool& inLineOfSight);
+    void Store(uint32 generation, float x1, float y1, float z1, float x2, float y2, float z2, uint32 ignoreFlags, bool inLineOfSight);
+
+private:
+    struct Key
+    {
+        std::array<int32, 6> Coords;
+        uint32 IgnoreFlags;
+
+        bool operator==(Key const& right) const = default;
+    };
+
+    struct KeyHash
+    {
+        std::size_t operator()(Key const& key) const;
+    };
+
+    static Key MakeKey(float x1, float y1, float z1, float x2, float y2, float z2, uint32 ignoreFlags);
+    void SyncGeneration(uint32 generation);
+
+    std::mutex _lock;
+    uint32 _generation = 0;
+    std::unordered_map<Key, bool, KeyHash> _results;
+};
+
+#endif // TRINITYCORE_LINE_OF_SIGHT_CACHE_H
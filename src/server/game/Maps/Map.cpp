@@ -26,6 +26,7 @@
 #include "GameTime.h"
 #include "GridNotifiers.h"
 #include "GridNotifiersImpl.h"
+#include "GridPreloader.h"
 #include "GridStates.h"
 #include "Group.h"
 #include "InstanceScript.h"
@@ -36,6 +37,7 @@
 #include "MiscPackets.h"
 #include "MMapFactory.h"
 #include "MotionMaster.h"
+#include "MoveSpline.h"
 #include "ObjectAccessor.h"
 #include "ObjectGridLoader.h"
 #include "ObjectMgr.h"
@@ -54,6 +56,9 @@
 #include "WeatherMgr.h"
 #include "World.h"
 #include <boost/heap/fibonacci_heap.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <algorithm>
 #include <unordered_set>
 #include <vector>
 
@@ -106,8 +111,6 @@ Map::~Map()
 
     if (!m_scriptSchedule.empty())
         sMapMgr->DecreaseScheduledScriptCount(m_scriptSchedule.size());
-
-    MMAP::MMapFactory::createOrGetMMapManager()->unloadMapInstance(GetId(), i_InstanceId);
 }
 
 bool Map::ExistMap(uint32 mapid, int gx, int gy)
@@ -188,6 +191,7 @@ void Map::LoadVMap(int gx, int gy)
     switch (vmapLoadResult)
     {
         case VMAP::VMAP_LOAD_RESULT_OK:
+            ++m_parentMap->_vmapTileGeneration;
             TC_LOG_DEBUG("maps", "VMAP loaded name:{}, id:{}, x:{}, y:{} (vmap rep.: x:{}, y:{})", GetMapName(), GetId(), gx, gy, gx, gy);
             break;
         case VMAP::VMAP_LOAD_RESULT_ERROR:
@@ -280,7 +284,8 @@ m_unloadTimer(0), m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE),
 m_VisibilityNotifyPeriod(DEFAULT_VISIBILITY_NOTIFY_PERIOD),
 m_activeNonPlayersIter(m_activeNonPlayers.end()), _transportsUpdateIter(_transports.end()),
 i_gridExpiry(expiry),
-i_scriptLock(false), _respawnTimes(std::make_unique<RespawnListContainer>()), _respawnCheckTimer(0)
+i_scriptLock(false), _respawnTimes(std::make_unique<RespawnListContainer>()), _respawnCheckTimer(0),
+_lastUpdateCost(0)
 {
     m_parentMap = (_parent ? _parent : this);
 #ifdef ELUNA
@@ -307,8 +312,9 @@ i_scriptLock(false), _respawnTimes(std::make_unique<RespawnListContainer>()), _r
     Map::InitVisibilityDistance();
 
     _weatherUpdateTimer.SetInterval(time_t(1 * IN_MILLISECONDS));
+    _gridPreloadTimer.SetInterval(time_t(1 * IN_MILLISECONDS));
 
-    MMAP::MMapFactory::createOrGetMMapManager()->loadMapInstance(sWorld->GetDataPath(), GetId(), GetInstanceId());
+    MMAP::MMapFactory::createOrGetMMapManager()->loadMapData(sWorld->GetDataPath(), GetId());
 }
 
 void Map::InitVisibilityDistance()
@@ -507,6 +513,9 @@ void Map::EnsureGridCreated_i(GridCoord const& p)
     if (!getNGrid(p.x_coord, p.y_coord))
     {
         TC_LOG_DEBUG("maps", "Creating grid[{}, {}] for map {} instance {}", p.x_coord, p.y_coord, GetId(), i_InstanceId);
+        TC_METRIC_TIMER("map_grid_load_time",
+            TC_METRIC_TAG("map_id", std::to_string(GetId())),
+            TC_METRIC_TAG("stage", "terrain"));
 
         setNGrid(new NGridType(p.x_coord*MAX_NUMBER_OF_GRIDS + p.y_coord, p.x_coord, p.y_coord, i_gridExpiry, sWorld->getBoolConfig(CONFIG_GRID_UNLOAD)),
             p.x_coord, p.y_coord);
@@ -551,6 +560,9 @@ bool Map::EnsureGridLoaded(Cell const& cell)
     if (!grid->isGridObjectDataLoaded())
     {
         TC_LOG_DEBUG("maps", "Loading grid[{}, {}] for map {} instance {}", cell.GridX(), cell.GridY(), GetId(), i_InstanceId);
+        TC_METRIC_TIMER("map_grid_load_time",
+            TC_METRIC_TAG("map_id", std::to_string(GetId())),
+            TC_METRIC_TAG("stage", "objects"));
 
         grid->setGridObjectDataLoaded(true);
 
@@ -756,6 +768,23 @@ void Map::VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<Trinity::Obj
     }
 }
 
+void Map::resetMarkedCells()
+{
+    for (uint32 cellId : _markedCellIds)
+        marked_cells.reset(cellId);
+
+    _markedCellIds.clear();
+}
+
+void Map::markCell(uint32 pCellId)
+{
+    if (marked_cells.test(pCellId))
+        return;
+
+    marked_cells.set(pCellId);
+    _markedCellIds.push_back(pCellId);
+}
+
 void Map::UpdatePlayerZoneStats(uint32 oldZone, uint32 newZone)
 {
     // Nothing to do if no change
@@ -771,32 +800,12 @@ void Map::UpdatePlayerZoneStats(uint32 oldZone, uint32 newZone)
     ++_zonePlayerCountMap[newZone];
 }
 
-void Map::Update(uint32 t_diff)
+void Map::UpdateActiveCells(uint32 t_diff)
 {
-    _dynamicTree.update(t_diff);
-    /// update worldsessions for existing players
-    for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
-    {
-        Player* player = m_mapRefIter->GetSource();
-        if (player && player->IsInWorld())
-        {
-            //player->Update(t_diff);
-            WorldSession* session = player->GetSession();
-            MapSessionFilter updater(session);
-            session->Update(t_diff, updater);
-        }
-    }
-
-    /// process any due respawns
-    if (_respawnCheckTimer <= t_diff)
-    {
-        ProcessRespawns();
-        _respawnCheckTimer = sWorld->getIntConfig(CONFIG_RESPAWN_MINCHECKINTERVALMS);
-    }
-    else
-        _respawnCheckTimer -= t_diff;
+    TC_METRIC_DETAILED_TIMER("map_update_phase_time",
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("phase", "objects"));
 
-    /// update active cells around players and active objects
     resetMarkedCells();
 
     Trinity::ObjectUpdater updater(t_diff);
@@ -884,8 +893,48 @@ void Map::Update(uint32 t_diff)
 
         obj->Update(t_diff);
     }
+}
+
+void Map::Update(uint32 t_diff)
+{
+    _dynamicTree.update(t_diff);
+    /// update worldsessions for existing players
+    {
+        TC_METRIC_DETAILED_TIMER("map_update_phase_time",
+            TC_METRIC_TAG("map_id", std::to_string(GetId())),
+            TC_METRIC_TAG("phase", "sessions"));
+
+        for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
+        {
+            Player* player = m_mapRefIter->GetSource();
+            if (player && player->IsInWorld())
+            {
+                //player->Update(t_diff);
+                WorldSession* session = player->GetSession();
+                MapSessionFilter updater(session);
+                session->Update(t_diff, updater);
+            }
+        }
+    }
+
+    /// process any due respawns
+    if (_respawnCheckTimer <= t_diff)
+    {
+        ProcessRespawns();
+        _respawnCheckTimer = sWorld->getIntConfig(CONFIG_RESPAWN_MINCHECKINTERVALMS);
+    }
+    else
+        _respawnCheckTimer -= t_diff;
+
+    /// update active cells around players and active objects
+    UpdateActiveCells(t_diff);
 
-    SendObjectUpdates();
+    {
+        TC_METRIC_DETAILED_TIMER("map_update_phase_time",
+            TC_METRIC_TAG("map_id", std::to_string(GetId())),
+            TC_METRIC_TAG("phase", "send_updates"));
+        SendObjectUpdates();
+    }
 
     ///- Process necessary scripts
     if (!m_scriptSchedule.empty())
@@ -905,11 +954,23 @@ void Map::Update(uint32 t_diff)
         _weatherUpdateTimer.Reset();
     }
 
+    _gridPreloadTimer.Update(t_diff);
+    if (_gridPreloadTimer.Passed())
+    {
+        PreloadGridsAhead();
+        _gridPreloadTimer.Reset();
+    }
+
     MoveAllCreaturesInMoveList();
     MoveAllGameObjectsInMoveList();
 
     if (!m_mapRefManager.isEmpty() || !m_activeNonPlayers.empty())
+    {
+        TC_METRIC_DETAILED_TIMER("map_update_phase_time",
+            TC_METRIC_TAG("map_id", std::to_string(GetId())),
+            TC_METRIC_TAG("phase", "relocation_notifies"));
         ProcessRelocationNotifies(t_diff);
+    }
 
     sScriptMgr->OnMapUpdate(this, t_diff);
 
@@ -934,6 +995,37 @@ struct ResetNotifier
     void Visit(PlayerMapType &m) { resetNotify<Player>(m);}
 };
 
+void Map::PreloadGridsAhead()
+{
+    for (MapReference const& ref : GetPlayers())
+    {
+        Player const* player = ref.GetSource();
+
+        // taxi flights and other server controlled paths carry their own velocity
+        float speed;
+        if (!player->movespline->Finalized())
+            speed = player->movespline->Velocity();
+        else if (player->isMoving())
+            speed = player->GetSpeed(player->IsFlying() ? MOVE_FLIGHT : MOVE_RUN);
+        else
+            continue;
+
+        for (float seconds : { 10.0f, 20.0f })
+        {
+            float x = player->GetPositionX() + std::cos(player->GetOrientation()) * speed * seconds;
+            float y = player->GetPositionY() + std::sin(player->GetOrientation()) * speed * seconds;
+            if (!Trinity::IsValidMapCoord(x, y))
+                break;
+
+            GridCoord p = Trinity::ComputeGridCoord(x, y);
+            if (getNGrid(p.x_coord, p.y_coord))
+                continue;
+
+            sGridPreloader->Prefetch(GetId(), (MAX_NUMBER_OF_GRIDS - 1) - p.x_coord, (MAX_NUMBER_OF_GRIDS - 1) - p.y_coord);
+        }
+    }
+}
+
 void Map::ProcessRelocationNotifies(const uint32 diff)
 {
     for (GridRefManager<NGridType>::iterator i = GridRefManager<NGridType>::begin(); i != GridRefManager<NGridType>::end(); ++i)
@@ -1098,6 +1190,7 @@ void Map::PlayerRelocation(Player* player, float x, float y, float z, float orie
     Cell new_cell(x, y);
 
     player->Relocate(x, y, z, orientation);
+    _unitPositionIndex.Relocate(player);
     if (player->IsVehicle())
         player->GetVehicleKit()->RelocatePassengers();
 
@@ -1139,6 +1232,7 @@ void Map::CreatureRelocation(Creature* creature, float x, float y, float z, floa
     else
     {
         creature->Relocate(x, y, z, ang);
+        _unitPositionIndex.Relocate(creature);
         if (creature->IsVehicle())
             creature->GetVehicleKit()->RelocatePassengers();
         creature->UpdateObjectVisibility(false);
@@ -1297,6 +1391,7 @@ void Map::MoveAllCreaturesInMoveList()
         {
             // update pos
             c->Relocate(c->_newPosition);
+            _unitPositionIndex.Relocate(c);
             if (c->IsVehicle())
                 c->GetVehicleKit()->RelocatePassengers();
             //CreatureRelocationNotify(c, new_cell, new_cell.cellCoord());
@@ -1622,6 +1717,7 @@ bool Map::CreatureRespawnRelocation(Creature* c, bool diffGridOnly)
     if (CreatureCellRelocation(c, resp_cell))
     {
         c->Relocate(resp_x, resp_y, resp_z, resp_o);
+        _unitPositionIndex.Relocate(c);
         c->GetMotionMaster()->Initialize(); // prevent possible problems with default move generators
         //CreatureRelocationNotify(c, resp_cell, resp_cell.GetCellCoord());
         c->UpdatePositionData();
@@ -1727,6 +1823,7 @@ bool Map::UnloadGrid(NGridType& ngrid, bool unloadAll)
             }
             VMAP::VMapFactory::createOrGetVMapManager()->unloadMap(GetId(), gx, gy);
             MMAP::MMapFactory::createOrGetMMapManager()->unloadMap(GetId(), gx, gy);
+            ++_vmapTileGeneration;
         }
         else
             ((MapInstanced*)m_parentMap)->RemoveGridMapReference(GridCoord(gx, gy));
@@ -1825,73 +1922,103 @@ GridMap::~GridMap()
     unloadData();
 }
 
+struct GridMapFileView
+{
+    boost::interprocess::mapped_region Region;
+    std::vector<std::unique_ptr<uint8[]>> UnalignedCopies;
+
+    template<typename T>
+    bool Read(std::size_t& offset, T& value) const
+    {
+        if (offset > Region.get_size() || Region.get_size() - offset < sizeof(T))
+            return false;
+
+        memcpy(&value, static_cast<uint8 const*>(Region.get_address()) + offset, sizeof(T));
+        offset += sizeof(T);
+        return true;
+    }
+
+    template<typename T>
+    T const* ReadArray(std::size_t& offset, std::size_t count)
+    {
+        std::size_t bytes = sizeof(T) * count;
+        if (offset > Region.get_size() || Region.get_size() - offset < bytes)
+            return nullptr;
+
+        uint8 const* data = static_cast<uint8 const*>(Region.get_address()) + offset;
+        offset += bytes;
+        if (reinterpret_cast<std::uintptr_t>(data) % alignof(T) == 0)
+            return reinterpret_cast<T const*>(data);
+
+        // array is not naturally aligned inside the file, keep a private copy
+        std::unique_ptr<uint8[]>& copy = UnalignedCopies.emplace_back(new uint8[bytes]);
+        memcpy(copy.get(), data, bytes);
+        return reinterpret_cast<T const*>(copy.get());
+    }
+};
+
 bool GridMap::loadData(char const* filename)
 {
     // Unload old data if exist
     unloadData();
 
-    map_fileheader header;
-    // Not return error if file not found
-    FILE* in = fopen(filename, "rb");
-    if (!in)
-        return true;
-
-    if (fread(&header, sizeof(header), 1, in) != 1)
+    // Map the whole file read only, pages are shared with every other process using the same data
+    // and are only read from disk when a lookup first touches them
+    _file = std::make_unique<GridMapFileView>();
+    try
     {
-        fclose(in);
-        return false;
+        boost::interprocess::file_mapping mapping(filename, boost::interprocess::read_only);
+        _file->Region = boost::interprocess::mapped_region(mapping, boost::interprocess::read_only);
+    }
+    catch (boost::interprocess::interprocess_exception const& e)
+    {
+        _file.reset();
+        // Not return error if file not found
+        return e.get_error_code() == boost::interprocess::not_found_error;
     }
 
+    map_fileheader header;
+    std::size_t offset = 0;
+    if (!_file->Read(offset, header))
+        return false;
+
     if (header.mapMagic.asUInt == MapMagic.asUInt && header.versionMagic == MapVersionMagic)
     {
         // load up area data
-        if (header.areaMapOffset && !loadAreaData(in, header.areaMapOffset, header.areaMapSize))
+        if (header.areaMapOffset && !loadAreaData(*_file, header.areaMapOffset, header.areaMapSize))
         {
             TC_LOG_ERROR("maps", "Error loading map area data\n");
-            fclose(in);
             return false;
         }
         // load up height data
-        if (header.heightMapOffset && !loadHeightData(in, header.heightMapOffset, header.heightMapSize))
+        if (header.heightMapOffset && !loadHeightData(*_file, header.heightMapOffset, header.heightMapSize))
         {
             TC_LOG_ERROR("maps", "Error loading map height data\n");
-            fclose(in);
             return false;
         }
         // load up liquid data
-        if (header.liquidMapOffset && !loadLiquidData(in, header.liquidMapOffset, header.liquidMapSize))
+        if (header.liquidMapOffset && !loadLiquidData(*_file, header.liquidMapOffset, header.liquidMapSize))
         {
             TC_LOG_ERROR("maps", "Error loading map liquids data\n");
-            fclose(in);
             return false;
         }
         // loadup holes data (if any. check header.holesOffset)
-        if (header.holesSize && !loadHolesData(in, header.holesOffset, header.holesSize))
+        if (header.holesSize && !loadHolesData(*_file, header.holesOffset, header.holesSize))
         {
             TC_LOG_ERROR("maps", "Error loading map holes data\n");
-            fclose(in);
             return false;
         }
-        fclose(in);
         return true;
     }
 
     TC_LOG_ERROR("maps", "Map file '{}' is from an incompatible map version (%.*s v{}), %.*s v{} is expected. Please pull your source, recompile tools and recreate maps using the updated mapextractor, then replace your old map files with new files. If you still have problems search on forum for error TCE00018.",
         filename, 4, header.mapMagic.asChar, header.versionMagic, 4, MapMagic.asChar, MapVersionMagic);
-    fclose(in);
     return false;
 }
 
 void GridMap::unloadData()
 {
-    delete[] _areaMap;
-    delete[] m_V9;
-    delete[] m_V8;
     delete[] _minHeightPlanes;
-    delete[] _liquidEntry;
-    delete[] _liquidFlags;
-    delete[] _liquidMap;
-    delete[] _holes;
     _areaMap = nullptr;
     m_V9 = nullptr;
     m_V8 = nullptr;
@@ -1901,32 +2028,31 @@ void GridMap::unloadData()
     _liquidMap  = nullptr;
     _holes = nullptr;
     _gridGetHeight = &GridMap::getHeightFromFlat;
+    _file.reset();
 }
 
-bool GridMap::loadAreaData(FILE* in, uint32 offset, uint32 /*size*/)
+bool GridMap::loadAreaData(GridMapFileView& file, uint32 offset, uint32 /*size*/)
 {
     map_areaHeader header;
-    fseek(in, offset, SEEK_SET);
-
-    if (fread(&header, sizeof(header), 1, in) != 1 || header.fourcc != MapAreaMagic.asUInt)
+    std::size_t pos = offset;
+    if (!file.Read(pos, header) || header.fourcc != MapAreaMagic.asUInt)
         return false;
 
     _gridArea = header.gridArea;
     if (!(header.flags & MAP_AREA_NO_AREA))
     {
-        _areaMap = new uint16[16 * 16];
-        if (fread(_areaMap, sizeof(uint16), 16*16, in) != 16*16)
+        _areaMap = file.ReadArray<uint16>(pos, 16 * 16);
+        if (!_areaMap)
             return false;
     }
     return true;
 }
 
-bool GridMap::loadHeightData(FILE* in, uint32 offset, uint32 /*size*/)
+bool GridMap::loadHeightData(GridMapFileView& file, uint32 offset, uint32 /*size*/)
 {
     map_heightHeader header;
-    fseek(in, offset, SEEK_SET);
-
-    if (fread(&header, sizeof(header), 1, in) != 1 || header.fourcc != MapHeightMagic.asUInt)
+    std::size_t pos = offset;
+    if (!file.Read(pos, header) || header.fourcc != MapHeightMagic.asUInt)
         return false;
 
     _gridHeight = header.gridHeight;
@@ -1934,30 +2060,27 @@ bool GridMap::loadHeightData(FILE* in, uint32 offset, uint32 /*size*/)
     {
         if ((header.flags & MAP_HEIGHT_AS_INT16))
         {
-            m_uint16_V9 = new uint16 [129*129];
-            m_uint16_V8 = new uint16 [128*128];
-            if (fread(m_uint16_V9, sizeof(uint16), 129*129, in) != 129*129 ||
-                fread(m_uint16_V8, sizeof(uint16), 128*128, in) != 128*128)
+            m_uint16_V9 = file.ReadArray<uint16>(pos, 129*129);
+            m_uint16_V8 = file.ReadArray<uint16>(pos, 128*128);
+            if (!m_uint16_V9 || !m_uint16_V8)
                 return false;
             _gridIntHeightMultiplier = (header.gridMaxHeight - header.gridHeight) / 65535;
             _gridGetHeight = &GridMap::getHeightFromUint16;
         }
         else if ((header.flags & MAP_HEIGHT_AS_INT8))
         {
-            m_uint8_V9 = new uint8 [129*129];
-            m_uint8_V8 = new uint8 [128*128];
-            if (fread(m_uint8_V9, sizeof(uint8), 129*129, in) != 129*129 ||
-                fread(m_uint8_V8, sizeof(uint8), 128*128, in) != 128*128)
+            m_uint8_V9 = file.ReadArray<uint8>(pos, 129*129);
+            m_uint8_V8 = file.ReadArray<uint8>(pos, 128*128);
+            if (!m_uint8_V9 || !m_uint8_V8)
                 return false;
             _gridIntHeightMultiplier = (header.gridMaxHeight - header.gridHeight) / 255;
             _gridGetHeight = &GridMap::getHeightFromUint8;
         }
         else
         {
-            m_V9 = new float [129*129];
-            m_V8 = new float [128*128];
-            if (fread(m_V9, sizeof(float), 129*129, in) != 129*129 ||
-                fread(m_V8, sizeof(float), 128*128, in) != 128*128)
+            m_V9 = file.ReadArray<float>(pos, 129*129);
+            m_V8 = file.ReadArray<float>(pos, 128*128);
+            if (!m_V9 || !m_V8)
                 return false;
             _gridGetHeight = &GridMap::getHeightFromFloat;
         }
@@ -1969,8 +2092,7 @@ bool GridMap::loadHeightData(FILE* in, uint32 offset, uint32 /*size*/)
     {
         std::array<int16, 9> maxHeights;
         std::array<int16, 9> minHeights;
-        if (fread(maxHeights.data(), sizeof(int16), maxHeights.size(), in) != maxHeights.size() ||
-            fread(minHeights.data(), sizeof(int16), minHeights.size(), in) != minHeights.size())
+        if (!file.Read(pos, maxHeights) || !file.Read(pos, minHeights))
             return false;
 
         static uint32 constexpr indices[8][3] =
@@ -2010,12 +2132,11 @@ bool GridMap::loadHeightData(FILE* in, uint32 offset, uint32 /*size*/)
     return true;
 }
 
-bool GridMap::loadLiquidData(FILE* in, uint32 offset, uint32 /*size*/)
+bool GridMap::loadLiquidData(GridMapFileView& file, uint32 offset, uint32 /*size*/)
 {
     map_liquidHeader header;
-    fseek(in, offset, SEEK_SET);
-
-    if (fread(&header, sizeof(header), 1, in) != 1 || header.fourcc != MapLiquidMagic.asUInt)
+    std::size_t pos = offset;
+    if (!file.Read(pos, header) || header.fourcc != MapLiquidMagic.asUInt)
         return false;
 
     _liquidGlobalEntry = header.liquidType;
@@ -2028,30 +2149,28 @@ bool GridMap::loadLiquidData(FILE* in, uint32 offset, uint32 /*size*/)
 
     if (!(header.flags & MAP_LIQUID_NO_TYPE))
     {
-        _liquidEntry = new uint16[16*16];
-        if (fread(_liquidEntry, sizeof(uint16), 16*16, in) != 16*16)
+        _liquidEntry = file.ReadArray<uint16>(pos, 16*16);
+        if (!_liquidEntry)
             return false;
 
-        _liquidFlags = new uint8[16*16];
-        if (fread(_liquidFlags, sizeof(uint8), 16*16, in) != 16*16)
+        _liquidFlags = file.ReadArray<uint8>(pos, 16*16);
+        if (!_liquidFlags)
             return false;
     }
     if (!(header.flags & MAP_LIQUID_NO_HEIGHT))
     {
-        _liquidMap = new float[uint32(_liquidWidth) * uint32(_liquidHeight)];
-        if (fread(_liquidMap, sizeof(float), _liquidWidth*_liquidHeight, in) != (uint32(_liquidWidth) * uint32(_liquidHeight)))
+        _liquidMap = file.ReadArray<float>(pos, uint32(_liquidWidth) * uint32(_liquidHeight));
+        if (!_liquidMap)
             return false;
     }
     return true;
 }
 
-bool GridMap::loadHolesData(FILE* in, uint32 offset, uint32 /*size*/)
+bool GridMap::loadHolesData(GridMapFileView& file, uint32 offset, uint32 /*size*/)
 {
-    if (fseek(in, offset, SEEK_SET) != 0)
-        return false;
-
-    _holes = new uint16[16 * 16];
-    if (fread(_holes, sizeof(uint16), 16 * 16, in) != 16 * 16)
+    std::size_t pos = offset;
+    _holes = file.ReadArray<uint16>(pos, 16 * 16);
+    if (!_holes)
         return false;
 
     return true;
@@ -2159,6 +2278,25 @@ float GridMap::getHeightFromFloat(float x, float y) const
     return a * x + b * y + c;
 }
 
+void GridMap::getHeights(float const* x, float const* y, float* heights, std::size_t count) const
+{
+    // pick the storage variant once for the whole batch so the loops below call it directly
+    auto fill = [&](auto getHeight)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            heights[i] = getHeight(x[i], y[i]);
+    };
+
+    if (_gridGetHeight == &GridMap::getHeightFromFloat)
+        fill([this](float px, float py) { return getHeightFromFloat(px, py); });
+    else if (_gridGetHeight == &GridMap::getHeightFromUint16)
+        fill([this](float px, float py) { return getHeightFromUint16(px, py); });
+    else if (_gridGetHeight == &GridMap::getHeightFromUint8)
+        fill([this](float px, float py) { return getHeightFromUint8(px, py); });
+    else
+        std::fill_n(heights, count, _gridHeight);
+}
+
 float GridMap::getHeightFromUint8(float x, float y) const
 {
     if (!m_uint8_V8 || !m_uint8_V9)
@@ -2178,7 +2316,7 @@ float GridMap::getHeightFromUint8(float x, float y) const
         return INVALID_HEIGHT;
 
     int32 a, b, c;
-    uint8 *V9_h1_ptr = &m_uint8_V9[x_int*128 + x_int + y_int];
+    uint8 const* V9_h1_ptr = &m_uint8_V9[x_int*128 + x_int + y_int];
     if (x+y < 1)
     {
         if (x > y)
@@ -2248,7 +2386,7 @@ float GridMap::getHeightFromUint16(float x, float y) const
         return INVALID_HEIGHT;
 
     int32 a, b, c;
-    uint16 *V9_h1_ptr = &m_uint16_V9[x_int*128 + x_int + y_int];
+    uint16 const* V9_h1_ptr = &m_uint16_V9[x_int*128 + x_int + y_int];
     if (x+y < 1)
     {
         if (x > y)
@@ -2494,10 +2632,21 @@ float Map::GetWaterOrGroundLevel(uint32 phasemask, float x, float y, float z, fl
 }
 
 float Map::GetHeight(float x, float y, float z, bool checkVMap /*= true*/, float maxSearchDist /*= DEFAULT_HEIGHT_SEARCH*/) const
+{
+    return GetHeightAboveGrid(GetGridHeight(x, y), x, y, z, checkVMap, maxSearchDist);
+}
+
+void Map::GetHeights(uint32 phasemask, float const* x, float const* y, float z, float* heights, std::size_t count, bool vmap /*= true*/, float maxSearchDist /*= DEFAULT_HEIGHT_SEARCH*/) const
+{
+    GetGridHeights(x, y, heights, count);
+    for (std::size_t i = 0; i < count; ++i)
+        heights[i] = std::max<float>(GetHeightAboveGrid(heights[i], x[i], y[i], z, vmap, maxSearchDist), GetGameObjectFloor(phasemask, x[i], y[i], z, maxSearchDist));
+}
+
+float Map::GetHeightAboveGrid(float gridHeight, float x, float y, float z, bool checkVMap, float maxSearchDist) const
 {
     // find raw .map surface under Z coordinates
     float mapHeight = VMAP_INVALID_HEIGHT_VALUE;
-    float gridHeight = GetGridHeight(x, y);
     if (G3D::fuzzyGe(z, gridHeight - GROUND_HEIGHT_TOLERANCE))
         mapHeight = gridHeight;
 
@@ -2539,6 +2688,29 @@ float Map::GetGridHeight(float x, float y) const
     return VMAP_INVALID_HEIGHT_VALUE;
 }
 
+void Map::GetGridHeights(float const* x, float const* y, float* heights, std::size_t count) const
+{
+    std::size_t runStart = 0;
+    while (runStart < count)
+    {
+        int gx = (int)(CENTER_GRID_ID - x[runStart] / SIZE_OF_GRIDS);
+        int gy = (int)(CENTER_GRID_ID - y[runStart] / SIZE_OF_GRIDS);
+
+        std::size_t runEnd = runStart + 1;
+        while (runEnd < count
+            && (int)(CENTER_GRID_ID - x[runEnd] / SIZE_OF_GRIDS) == gx
+            && (int)(CENTER_GRID_ID - y[runEnd] / SIZE_OF_GRIDS) == gy)
+            ++runEnd;
+
+        if (GridMap* gmap = const_cast<Map*>(this)->GetGrid(x[runStart], y[runStart]))
+            gmap->getHeights(x + runStart, y + runStart, heights + runStart, runEnd - runStart);
+        else
+            std::fill(heights + runStart, heights + runEnd, VMAP_INVALID_HEIGHT_VALUE);
+
+        runStart = runEnd;
+    }
+}
+
 float Map::GetMinHeight(float x, float y) const
 {
     if (GridMap const* grid = const_cast<Map*>(this)->GetGrid(x, y))
@@ -2881,9 +3053,20 @@ float Map::GetWaterLevel(float x, float y) const
 
 bool Map::isInLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const
 {
-    if ((checks & LINEOFSIGHT_CHECK_VMAP)
-      && !VMAP::VMapFactory::createOrGetVMapManager()->isInLineOfSight(GetId(), x1, y1, z1, x2, y2, z2, ignoreFlags))
-        return false;
+    if (checks & LINEOFSIGHT_CHECK_VMAP)
+    {
+        // static geometry only changes when vmap tiles come and go, dynamic collision below is never cached
+        uint32 generation = m_parentMap->_vmapTileGeneration.load(std::memory_order_acquire);
+        bool inLineOfSight;
+        if (!_lineOfSightCache.Find(generation, x1, y1, z1, x2, y2, z2, uint32(ignoreFlags), inLineOfSight))
+        {
+            inLineOfSight = VMAP::VMapFactory::createOrGetVMapManager()->isInLineOfSight(GetId(), x1, y1, z1, x2, y2, z2, ignoreFlags);
+            _lineOfSightCache.Store(generation, x1, y1, z1, x2, y2, z2, uint32(ignoreFlags), inLineOfSight);
+        }
+
+        if (!inLineOfSight)
+            return false;
+    }
     if (sWorld->getBoolConfig(CONFIG_CHECK_GOBJECT_LOS) && (checks & LINEOFSIGHT_CHECK_GOBJECT)
       && !_dynamicTree.isInLineOfSight(x1, y1, z1, x2, y2, z2, phasemask))
         return false;
@@ -3689,8 +3872,12 @@ uint32 Map::GetPlayersCountExceptGMs() const
 
 void Map::SendToPlayers(WorldPacket const* data) const
 {
+    if (m_mapRefManager.isEmpty())
+        return;
+
+    std::shared_ptr<WorldPacket const> sharedData = std::make_shared<WorldPacket const>(*data);
     for (MapRefManager::const_iterator itr = m_mapRefManager.begin(); itr != m_mapRefManager.end(); ++itr)
-        itr->GetSource()->SendDirectMessage(data);
+        itr->GetSource()->SendDirectMessage(sharedData);
 }
 
 /// Send a packet to all players (or players selected team) in the zone (except self if mentioned)
@@ -24,16 +24,20 @@
 #include "DynamicTree.h"
 #include "GridDefines.h"
 #include "GridRefManager.h"
+#include "LineOfSightCache.h"
 #include "MapDefines.h"
 #include "MapRefManager.h"
 #include "MPSCQueue.h"
 #include "ObjectGuid.h"
 #include "Optional.h"
+#include "PathCache.h"
 #include "SharedDefines.h"
 #include "SpawnData.h"
 #include "Timer.h"
 #include "Transaction.h"
+#include "UnitPositionIndex.h"
 #include "UniqueTrackablePtr.h"
+#include <atomic>
 #include <bitset>
 #include <list>
 #include <memory>
@@ -158,18 +162,22 @@ struct map_liquidHeader
 
 #define MAP_LIQUID_TYPE_DARK_WATER  0x10
 
+struct GridMapFileView;
+
 class TC_GAME_API GridMap
 {
     uint32  _flags;
+    // the file is memory mapped, all arrays below point into it
+    std::unique_ptr<GridMapFileView> _file;
     union{
-        float* m_V9;
-        uint16* m_uint16_V9;
-        uint8* m_uint8_V9;
+        float const* m_V9;
+        uint16 const* m_uint16_V9;
+        uint8 const* m_uint8_V9;
     };
     union{
-        float* m_V8;
-        uint16* m_uint16_V8;
-        uint8* m_uint8_V8;
+        float const* m_V8;
+        uint16 const* m_uint16_V8;
+        uint8 const* m_uint8_V8;
     };
     G3D::Plane* _minHeightPlanes;
     // Height level data
@@ -177,13 +185,13 @@ class TC_GAME_API GridMap
     float _gridIntHeightMultiplier;
 
     // Area data
-    uint16* _areaMap;
+    uint16 const* _areaMap;
 
     // Liquid data
     float _liquidLevel;
-    uint16* _liquidEntry;
-    uint8* _liquidFlags;
-    float* _liquidMap;
+    uint16 const* _liquidEntry;
+    uint8 const* _liquidFlags;
+    float const* _liquidMap;
     uint16 _gridArea;
     uint16 _liquidGlobalEntry;
     uint8 _liquidGlobalFlags;
@@ -192,12 +200,12 @@ class TC_GAME_API GridMap
     uint8 _liquidWidth;
     uint8 _liquidHeight;
 
-    uint16* _holes;
+    uint16 const* _holes;
 
-    bool loadAreaData(FILE* in, uint32 offset, uint32 size);
-    bool loadHeightData(FILE* in, uint32 offset, uint32 size);
-    bool loadLiquidData(FILE* in, uint32 offset, uint32 size);
-    bool loadHolesData(FILE* in, uint32 offset, uint32 size);
+    bool loadAreaData(GridMapFileView& file, uint32 offset, uint32 size);
+    bool loadHeightData(GridMapFileView& file, uint32 offset, uint32 size);
+    bool loadLiquidData(GridMapFileView& file, uint32 offset, uint32 size);
+    bool loadHolesData(GridMapFileView& file, uint32 offset, uint32 size);
     bool isHole(int row, int col) const;
 
     // Get height functions and pointers
@@ -216,6 +224,7 @@ public:
 
     uint16 getArea(float x, float y) const;
     inline float getHeight(float x, float y) const {return (this->*_gridGetHeight)(x, y);}
+    void getHeights(float const* x, float const* y, float* heights, std::size_t count) const;
     float getMinHeight(float x, float y) const;
     float getLiquidLevel(float x, float y) const;
     ZLiquidStatus GetLiquidStatus(float x, float y, float z, Optional<uint8> ReqLiquidType, LiquidData* data = 0, float collisionHeight = 2.03128f); // DEFAULT_COLLISION_HEIGHT in Object.h
@@ -315,6 +324,10 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         void VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<Trinity::ObjectUpdater, GridTypeMapContainer> &gridVisitor, TypeContainerVisitor<Trinity::ObjectUpdater, WorldTypeMapContainer> &worldVisitor);
         virtual void Update(uint32);
 
+        // wall time spent in the previous Update() call, used by MapUpdater to start the most expensive maps first
+        Microseconds GetLastUpdateCost() const { return _lastUpdateCost; }
+        void SetLastUpdateCost(Microseconds cost) { _lastUpdateCost = cost; }
+
         float GetVisibilityRange() const { return m_VisibleDistance; }
         //function for setting up visibility distance for maps on per-type/per-Id basis
         virtual void InitVisibilityDistance();
@@ -437,9 +450,9 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         void AddObjectToSwitchList(WorldObject* obj, bool on);
         virtual void DelayedUpdate(uint32 diff);
 
-        void resetMarkedCells() { marked_cells.reset(); }
+        void resetMarkedCells();
         bool isCellMarked(uint32 pCellId) { return marked_cells.test(pCellId); }
-        void markCell(uint32 pCellId) { marked_cells.set(pCellId); }
+        void markCell(uint32 pCellId);
 
         bool HavePlayers() const { return !m_mapRefManager.isEmpty(); }
         uint32 GetPlayersCountExceptGMs() const;
@@ -494,6 +507,8 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         Pet* GetPet(ObjectGuid const& guid);
 
         MapStoredObjectTypesContainer& GetObjectsStore() { return _objectsStore; }
+        UnitPositionIndex& GetUnitPositionIndex() { return _unitPositionIndex; }
+        PathCache& GetPathCache() { return _pathCache; }
 
         typedef std::unordered_multimap<ObjectGuid::LowType, Creature*> CreatureBySpawnIdContainer;
         CreatureBySpawnIdContainer& GetCreatureBySpawnIdStore() { return _creatureBySpawnIdStore; }
@@ -534,9 +549,13 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         float GetMinHeight(float x, float y) const;
         float GetHeight(float x, float y, float z, bool checkVMap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const;
         float GetGridHeight(float x, float y) const;
+        // fills heights[i] with GetGridHeight(x[i], y[i]), the grid is resolved once per run of points sharing it
+        void GetGridHeights(float const* x, float const* y, float* heights, std::size_t count) const;
         float GetHeight(Position const& pos, bool vmap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const { return GetHeight(pos.GetPositionX(), pos.GetPositionY(), pos.GetPositionZ(), vmap, maxSearchDist); }
         float GetHeight(uint32 phasemask, float x, float y, float z, bool vmap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const { return std::max<float>(GetHeight(x, y, z, vmap, maxSearchDist), GetGameObjectFloor(phasemask, x, y, z, maxSearchDist)); }
         float GetHeight(uint32 phasemask, Position const& pos, bool vmap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const { return GetHeight(phasemask, pos.GetPositionX(), pos.GetPositionY(), pos.GetPositionZ(), vmap, maxSearchDist); }
+        // fills heights[i] with GetHeight(phasemask, x[i], y[i], z, ...), terrain heights of all points are looked up in one batch
+        void GetHeights(uint32 phasemask, float const* x, float const* y, float z, float* heights, std::size_t count, bool vmap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const;
         bool isInLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const;
         void Balance() { _dynamicTree.balance(); }
         void RemoveGameObjectModel(GameObjectModel const& model) { _dynamicTree.remove(model); }
@@ -627,6 +646,8 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         void LoadMap(int gx, int gy, bool reload = false);
         void LoadMMap(int gx, int gy);
         GridMap* GetGrid(float x, float y);
+        // picks between the given .map surface height and the vmap height for GetHeight
+        float GetHeightAboveGrid(float gridHeight, float x, float y, float z, bool checkVMap, float maxSearchDist) const;
 
         void SetTimer(uint32 t) { i_gridExpiry = t < MIN_GRID_DELAY ? MIN_GRID_DELAY : t; }
 
@@ -670,6 +691,7 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         void setNGrid(NGridType* grid, uint32 x, uint32 y);
         void ScriptsProcess();
 
+        void UpdateActiveCells(uint32 diff);
         void SendObjectUpdates();
 
     protected:
@@ -685,6 +707,10 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         uint32 m_unloadTimer;
         float m_VisibleDistance;
         DynamicMapTree _dynamicTree;
+        mutable LineOfSightCache _lineOfSightCache;
+        PathCache _pathCache;
+        // bumped on the parent map whenever vmap tiles of this map id are loaded or unloaded
+        std::atomic<uint32> _vmapTileGeneration{ 0 };
 
         MapRefManager m_mapRefManager;
         MapRefManager::iterator m_mapRefIter;
@@ -720,11 +746,15 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         NGridType* i_grids[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
         GridMap* GridMaps[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
         std::bitset<TOTAL_NUMBER_OF_CELLS_PER_MAP*TOTAL_NUMBER_OF_CELLS_PER_MAP> marked_cells;
+        std::vector<uint32> _markedCellIds; // ids set in marked_cells this tick, avoids clearing the whole bitset every update
 
         //these functions used to process player/mob aggro reactions and
         //visibility calculations. Highly optimized for massive calculations
         void ProcessRelocationNotifies(const uint32 diff);
 
+        // queues background reads of the grid files players are heading to
+        void PreloadGridsAhead();
+
         bool i_scriptLock;
         std::set<WorldObject*> i_objectsToRemove;
         std::map<WorldObject*, bool> i_objectsToSwitch;
@@ -853,15 +883,18 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         std::unordered_set<uint32> _toggledSpawnGroupIds;
 
         uint32 _respawnCheckTimer;
+        Microseconds _lastUpdateCost;
         std::unordered_map<uint32, uint32> _zonePlayerCountMap;
 
         ZoneDynamicInfoMap _zoneDynamicInfo;
         IntervalTimer _weatherUpdateTimer;
+        IntervalTimer _gridPreloadTimer;
 
         ObjectGuidGenerator& GetGuidSequenceGenerator(HighGuid high);
 
         std::map<HighGuid, std::unique_ptr<ObjectGuidGenerator>> _guidGenerators;
         MapStoredObjectTypesContainer _objectsStore;
+        UnitPositionIndex _unitPositionIndex;
         CreatureBySpawnIdContainer _creatureBySpawnIdStore;
         GameObjectBySpawnIdContainer _gameobjectBySpawnIdStore;
         std::unordered_map<uint32/*cellId*/, std::unordered_set<Corpse*>> _corpsesByCell;
@@ -291,6 +291,7 @@ bool MapInstanced::DestroyInstance(InstancedMaps::iterator &itr)
     {
         VMAP::VMapFactory::createOrGetVMapManager()->unloadMap(itr->second->GetId());
         MMAP::MMapFactory::createOrGetMMapManager()->unloadMap(itr->second->GetId());
+        ++_vmapTileGeneration;
         // in that case, unload grids of the base map, too
         // so in the next map creation, (EnsureGridCreated actually) VMaps will be reloaded
         Map::UnloadAll();
@@ -34,6 +34,7 @@
 #include "WorldSession.h"
 #include "Opcodes.h"
 #include "ScriptMgr.h"
+#include <algorithm>
 #include <numeric>
 #ifdef ELUNA
 #include "LuaEngine.h"
@@ -225,15 +226,29 @@ void MapManager::Update(uint32 diff)
         return;
 
     MapMapType::iterator iter = i_maps.begin();
-    for (; iter != i_maps.end(); ++iter)
+    if (m_updater.activated())
     {
-        if (m_updater.activated())
-            m_updater.schedule_update(*iter->second, uint32(i_timer.GetCurrent()));
-        else
+        // hand out the most expensive maps of the previous tick first so they do not end up last on the critical path
+        std::vector<Map*> maps;
+        maps.reserve(i_maps.size());
+        for (; iter != i_maps.end(); ++iter)
+            maps.push_back(iter->second.get());
+
+        std::sort(maps.begin(), maps.end(), [](Map const* left, Map const* right)
+        {
+            return left->GetLastUpdateCost() > right->GetLastUpdateCost();
+        });
+
+        for (Map* map : maps)
+            m_updater.schedule_update(*map, uint32(i_timer.GetCurrent()));
+
+        m_updater.wait();
+    }
+    else
+    {
+        for (; iter != i_maps.end(); ++iter)
             iter->second->Update(uint32(i_timer.GetCurrent()));
     }
-    if (m_updater.activated())
-        m_updater.wait();
 
     for (iter = i_maps.begin(); iter != i_maps.end(); ++iter)
         iter->second->DelayedUpdate(uint32(i_timer.GetCurrent()));
@@ -20,6 +20,7 @@
 #include "Map.h"
 #include "Metric.h"
 
+#include <algorithm>
 #include <mutex>
 
 class MapUpdateRequest
@@ -29,22 +30,39 @@ class MapUpdateRequest
         Map& m_map;
         MapUpdater& m_updater;
         uint32 m_diff;
+        Microseconds m_expectedCost;
 
     public:
 
         MapUpdateRequest(Map& m, MapUpdater& u, uint32 d)
-            : m_map(m), m_updater(u), m_diff(d)
+            : m_map(m), m_updater(u), m_diff(d), m_expectedCost(m.GetLastUpdateCost())
         {
         }
 
+        Microseconds GetExpectedCost() const { return m_expectedCost; }
+
         void call()
         {
-            TC_METRIC_TIMER("map_update_time_diff", TC_METRIC_TAG("map_id", std::to_string(m_map.GetId())));
-            m_map.Update (m_diff);
-            m_updater.update_finished();
+            TimePoint start = std::chrono::steady_clock::now();
+            {
+                TC_METRIC_TIMER("map_update_time_diff",
+                    TC_METRIC_TAG("map_id", std::to_string(m_map.GetId())),
+                    TC_METRIC_TAG("map_instanceid", std::to_string(m_map.GetInstanceId())));
+                m_map.Update (m_diff);
+            }
+
+            Microseconds cost = std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - start);
+            m_map.SetLastUpdateCost(cost);
+            m_updater.update_finished(cost);
         }
 };
 
+bool MapUpdater::MapUpdateRequestCostCompare::operator()(MapUpdateRequest const* left, MapUpdateRequest const* right) const
+{
+    // std::priority_queue pops the greatest element first - most expensive map on top
+    return left->GetExpectedCost() < right->GetExpectedCost();
+}
+
 void MapUpdater::activate(size_t num_threads)
 {
     for (size_t i = 0; i < num_threads; ++i)
@@ -55,11 +73,14 @@ void MapUpdater::activate(size_t num_threads)
 
 void MapUpdater::deactivate()
 {
-    _cancelationToken = true;
-
     wait();
 
-    _queue.Cancel();
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        _cancelationToken = true;
+    }
+
+    _queueCondition.notify_all();
 
     for (auto& thread : _workerThreads)
     {
@@ -74,7 +95,12 @@ void MapUpdater::wait()
     while (pending_requests > 0)
         _condition.wait(lock);
 
+    Microseconds criticalPath = _tickCriticalPath;
+    _tickCriticalPath = Microseconds::zero();
+
     lock.unlock();
+
+    TC_METRIC_VALUE("map_update_critical_path", std::chrono::nanoseconds(criticalPath));
 }
 
 void MapUpdater::schedule_update(Map& map, uint32 diff)
@@ -83,7 +109,9 @@ void MapUpdater::schedule_update(Map& map, uint32 diff)
 
     ++pending_requests;
 
-    _queue.Push(new MapUpdateRequest(map, *this, diff));
+    _queue.push(new MapUpdateRequest(map, *this, diff));
+
+    _queueCondition.notify_one();
 }
 
 bool MapUpdater::activated()
@@ -91,12 +119,14 @@ bool MapUpdater::activated()
     return _workerThreads.size() > 0;
 }
 
-void MapUpdater::update_finished()
+void MapUpdater::update_finished(Microseconds cost)
 {
     std::lock_guard<std::mutex> lock(_lock);
 
     --pending_requests;
 
+    _tickCriticalPath = std::max(_tickCriticalPath, cost);
+
     _condition.notify_all();
 }
 
@@ -110,10 +140,17 @@ void MapUpdater::WorkerThread()
     {
         MapUpdateRequest* request = nullptr;
 
-        _queue.WaitAndPop(request);
+        {
+            std::unique_lock<std::mutex> lock(_lock);
+
+            _queueCondition.wait(lock, [this] { return _cancelationToken || !_queue.empty(); });
 
-        if (_cancelationToken)
-            return;
+            if (_cancelationToken)
+                return;
+
+            request = _queue.top();
+            _queue.pop();
+        }
 
         request->call();
 
@@ -19,19 +19,30 @@
 #define _MAP_UPDATER_H_INCLUDED
 
 #include "Define.h"
+#include "Duration.h"
+#include <atomic>
 #include <mutex>
+#include <queue>
 #include <thread>
 #include <condition_variable>
-#include "ProducerConsumerQueue.h"
+#include <vector>
 
 class MapUpdateRequest;
 class Map;
 
+/*
+ * Schedules map updates on a pool of worker threads.
+ *
+ * Pending requests are kept ordered by the wall time each map needed for its previous
+ * update (longest processing time first), so a single expensive continent is started as
+ * early as possible and cheap instances fill the remaining workers around it instead of
+ * extending the critical path of the tick.
+ */
 class TC_GAME_API MapUpdater
 {
     public:
 
-        MapUpdater() : _cancelationToken(false), pending_requests(0) {}
+        MapUpdater() : _cancelationToken(false), pending_requests(0), _tickCriticalPath(0) {}
         ~MapUpdater() { };
 
         friend class MapUpdateRequest;
@@ -48,16 +59,25 @@ class TC_GAME_API MapUpdater
 
     private:
 
-        ProducerConsumerQueue<MapUpdateRequest*> _queue;
+        struct MapUpdateRequestCostCompare
+        {
+            bool operator()(MapUpdateRequest const* left, MapUpdateRequest const* right) const;
+        };
+
+        std::priority_queue<MapUpdateRequest*, std::vector<MapUpdateRequest*>, MapUpdateRequestCostCompare> _queue;
 
         std::vector<std::thread> _workerThreads;
         std::atomic<bool> _cancelationToken;
 
         std::mutex _lock;
         std::condition_variable _condition;
+        std::condition_variable _queueCondition;
         size_t pending_requests;
 
-        void update_finished();
+        // longest single map update of the current tick, reported once all requests finished
+        Microseconds _tickCriticalPath;
+
+        void update_finished(Microseconds cost);
 
         void WorkerThread();
 };
@@ -0,0 +1,184 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "UnitPositionIndex.h"
+#include "Errors.h"
+#include "GridDefines.h"
+#include "Unit.h"
+#include <algorithm>
+
+namespace
+{
+    // small enough that typical aoe radii only touch a handful of buckets
+    constexpr float BUCKET_SIZE = 16.0f;
+    constexpr uint32 BUCKETS_PER_AXIS = uint32(MAP_SIZE / BUCKET_SIZE) + 1;
+}
+
+uint32 UnitPositionIndex::GetBucketCoord(float c)
+{
+    float offset = (c + MAP_HALFSIZE) / BUCKET_SIZE;
+    if (!(offset > 0.0f))
+        return 0;
+
+    return std::min(uint32(offset), BUCKETS_PER_AXIS - 1);
+}
+
+uint32 UnitPositionIndex::GetBucketId(uint32 x, uint32 y)
+{
+    return x * BUCKETS_PER_AXIS + y;
+}
+
+void UnitPositionIndex::AddToBucket(Unit* unit, float x, float y, uint32 bucketId, Slot& slot)
+{
+    Bucket& bucket = _buckets[bucketId];
+    slot.BucketId = bucketId;
+    slot.Index = uint32(bucket.Units.size());
+    bucket.PositionX.push_back(x);
+    bucket.PositionY.push_back(y);
+    bucket.Units.push_back(unit);
+}
+
+void UnitPositionIndex::RemoveFromBucket(Slot const& slot)
+{
+    auto itr = _buckets.find(slot.BucketId);
+    Bucket& bucket = itr->second;
+
+    // swap with the last entry to keep the arrays dense
+    uint32 last = uint32(bucket.Units.size() - 1);
+    if (slot.Index != last)
+    {
+        bucket.PositionX[slot.Index] = bucket.PositionX[last];
+        bucket.PositionY[slot.Index] = bucket.PositionY[last];
+        bucket.Units[slot.Index] = bucket.Units[last];
+        _slots[bucket.Units[slot.Index]].Index = slot.Index;
+    }
+
+    bucket.PositionX.pop_back();
+    bucket.PositionY.pop_back();
+    bucket.Units.pop_back();
+
+    if (bucket.Units.empty())
+        _buckets.erase(itr);
+}
+
+void UnitPositionIndex::Insert(Unit* unit)
+{
+    Insert(unit, unit->GetPositionX(), unit->GetPositionY());
+}
+
+void UnitPositionIndex::Insert(Unit* unit, float x, float y)
+{
+    auto [itr, inserted] = _slots.try_emplace(unit);
+    if (!inserted)
+    {
+        Relocate(unit, x, y);
+        return;
+    }
+
+    AddToBucket(unit, x, y, GetBucketId(GetBucketCoord(x), GetBucketCoord(y)), itr->second);
+}
+
+void UnitPositionIndex::Relocate(Unit* unit)
+{
+    Relocate(unit, unit->GetPositionX(), unit->GetPositionY());
+}
+
+void UnitPositionIndex::Relocate(Unit* unit, float x, float y)
+{
+    auto itr = _slots.find(unit);
+    if (itr == _slots.end())
+        return;
+
+    Slot& slot = itr->second;
+    uint32 bucketId = GetBucketId(GetBucketCoord(x), GetBucketCoord(y));
+    if (bucketId == slot.BucketId)
+    {
+        Bucket& bucket = _buckets[bucketId];
+        bucket.PositionX[slot.Index] = x;
+        bucket.PositionY[slot.Index] = y;
+        return;
+    }
+
+    RemoveFromBucket(slot);
+    AddToBucket(unit, x, y, bucketId, slot);
+}
+
+void UnitPositionIndex::Remove(Unit* unit)
+{
+    auto itr = _slots.find(unit);
+    if (itr == _slots.end())
+        return;
+
+    Slot slot = itr->second;
+    _slots.erase(itr);
+    RemoveFromBucket(slot);
+}
+
+void UnitPositionIndex::GetUnitsInRange(float x, float y, float radius, std::vector<Unit*>& units) const
+{
+    uint32 lowX = GetBucketCoord(x - radius);
+    uint32 highX = GetBucketCoord(x + radius);
+    uint32 lowY = GetBucketCoord(y - radius);
+    uint32 highY = GetBucketCoord(y + radius);
+    float radiusSq = radius * radius;
+
+    auto scanBucket = [&](Bucket const& bucket)
+    {
+        float const* positionX = bucket.PositionX.data();
+        float const* positionY = bucket.PositionY.data();
+        std::size_t count = bucket.Units.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            float dx = positionX[i] - x;
+            float dy = positionY[i] - y;
+            if (dx * dx + dy * dy <= radiusSq)
+                units.push_back(bucket.Units[i]);
+        }
+    };
+
+    // large radii cover more buckets than there are occupied ones
+    if (std::size_t(highX - lowX + 1) * (highY - lowY + 1) > _buckets.size())
+    {
+        for (auto const& [bucketId, bucket] : _buckets)
+            scanBucket(bucket);
+        return;
+    }
+
+    for (uint32 bucketX = lowX; bucketX <= highX; ++bucketX)
+    {
+        for (uint32 bucketY = lowY; bucketY <= highY; ++bucketY)
+        {
+            auto itr = _buckets.find(GetBucketId(bucketX, bucketY));
+            if (itr == _buckets.end())
+                continue;
+
+            scanBucket(itr->second);
+        }
+    }
+}
+
+void UnitPositionIndex::CheckPosition(Unit const* unit) const
+{
+    auto itr = _slots.find(const_cast<Unit*>(unit));
+    ASSERT(itr != _slots.end(), "Unit %s is in world but missing from the position index", unit->GetGUID().ToString().c_str());
+
+    Bucket const& bucket = _buckets.at(itr->second.BucketId);
+    float x = bucket.PositionX[itr->second.Index];
+    float y = bucket.PositionY[itr->second.Index];
+    ASSERT(x == unit->GetPositionX() && y == unit->GetPositionY(), "Unit %s is indexed at (%f, %f) but is at (%f, %f)",
+        unit->GetGUID().ToString().c_str(), x, y, unit->GetPositionX(), unit->GetPositionY());
+}
@@ -0,0 +1,71 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_UNIT_POSITION_INDEX_H
+#define TRINITYCORE_UNIT_POSITION_INDEX_H
+
+#include "Define.h"
+#include <unordered_map>
+#include <vector>
+
+class Unit;
+
+/// Compact per map index of unit 2d positions, bucketed by a uniform hash grid.
+/// Positions are stored as plain float arrays so radius queries scan contiguous memory
+/// instead of dereferencing every object in the visited grid cells.
+/// Kept up to date by Unit::AddToWorld/RemoveFromWorld and the Map relocation functions;
+/// results are candidates only, callers still run their exact checks on the live objects.
+class TC_GAME_API UnitPositionIndex
+{
+public:
+    void Insert(Unit* unit);
+    void Insert(Unit* unit, float x, float y);
+    void Relocate(Unit* unit);
+    void Relocate(Unit* unit, float x, float y);
+    void Remove(Unit* unit);
+
+    /// Appends all units whose indexed position lies within radius of x, y
+    void GetUnitsInRange(float x, float y, float radius, std::vector<Unit*>& units) const;
+
+    /// Asserts that the unit is indexed at its current position
+    void CheckPosition(Unit const* unit) const;
+
+private:
+    struct Bucket
+    {
+        std::vector<float> PositionX;
+        std::vector<float> PositionY;
+        std::vector<Unit*> Units;
+    };
+
+    struct Slot
+    {
+        uint32 BucketId;
+        uint32 Index;
+    };
+
+    static uint32 GetBucketCoord(float c);
+    static uint32 GetBucketId(uint32 x, uint32 y);
+
+    void AddToBucket(Unit* unit, float x, float y, uint32 bucketId, Slot& slot);
+    void RemoveFromBucket(Slot const& slot);
+
+    std::unordered_map<uint32, Bucket> _buckets;
+    std::unordered_map<Unit*, Slot> _slots;
+};
+
+#endif // TRINITYCORE_UNIT_POSITION_INDEX_H
@@ -856,20 +856,26 @@ void MotionMaster::MoveCirclePath(float x, float y, float z, float radius, bool
         // add the owner's current position as starting point as it gets removed after entering the cycle
         init.Path().push_back(G3D::Vector3(_owner->GetPositionX(), _owner->GetPositionY(), _owner->GetPositionZ()));
 
+        std::vector<float> pointsX(stepCount);
+        std::vector<float> pointsY(stepCount);
+        std::vector<float> pointsZ(stepCount, z);
         for (uint8 i = 0; i < stepCount; angle += step, ++i)
         {
-            G3D::Vector3 point;
-            point.x = x + radius * cosf(angle);
-            point.y = y + radius * sinf(angle);
-
-            if (_owner->IsFlying())
-                point.z = z;
-            else
-                point.z = _owner->GetMapHeight(point.x, point.y, z) + _owner->GetHoverOffset();
+            pointsX[i] = x + radius * cosf(angle);
+            pointsY[i] = y + radius * sinf(angle);
+        }
 
-            init.Path().push_back(point);
+        // probe the ground under all points at once, same as WorldObject::GetMapHeight would for each of them
+        if (!_owner->IsFlying())
+        {
+            _owner->GetMap()->GetHeights(_owner->GetPhaseMask(), pointsX.data(), pointsY.data(), z != MAX_HEIGHT ? z + Z_OFFSET_FIND_HEIGHT : z, pointsZ.data(), stepCount);
+            for (float& pointZ : pointsZ)
+                pointZ += _owner->GetHoverOffset();
         }
 
+        for (uint8 i = 0; i < stepCount; ++i)
+            init.Path().push_back(G3D::Vector3(pointsX[i], pointsY[i], pointsZ[i]));
+
         if (_owner->IsFlying())
         {
             init.SetFly();
@@ -0,0 +1,69 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PathCache.h"
+#include "Hash.h"
+#include <algorithm>
+
+namespace
+{
+    // upper bound on remembered corridors per map, the cache starts over once reached
+    constexpr std::size_t MAX_CACHED_PATHS = 4096;
+}
+
+std::size_t PathCache::KeyHash::operator()(Key const& key) const
+{
+    std::size_t hashVal = 0;
+    Trinity::hash_combine(hashVal, key.StartPoly);
+    Trinity::hash_combine(hashVal, key.EndPoly);
+    Trinity::hash_combine(hashVal, key.IncludeFlags);
+    Trinity::hash_combine(hashVal, key.ExcludeFlags);
+    return hashVal;
+}
+
+bool PathCache::Find(Key const& key, dtPolyRef* path, uint32& length, uint32 maxLength)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    auto itr = _paths.find(key);
+    if (itr == _paths.end() || itr->second.size() > maxLength)
+        return false;
+
+    std::copy(itr->second.begin(), itr->second.end(), path);
+    length = uint32(itr->second.size());
+    return true;
+}
+
+void PathCache::Store(Key const& key, dtPolyRef const* path, uint32 length)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    if (_paths.size() >= MAX_CACHED_PATHS)
+        _paths.clear();
+
+    _paths[key].assign(path, path + length);
+}
+
+std::size_t PathCache::GetSize()
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    return _paths.size();
+}
+
+void PathCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    _paths.clear();
+}
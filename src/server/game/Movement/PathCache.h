@@ -0,0 +1,60 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_PATH_CACHE_H
+#define TRINITYCORE_PATH_CACHE_H
+
+#include "Define.h"
+#include "DetourNavMesh.h"
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/// Remembers polygon corridors found by PathGenerator so units pathing between the same
+/// pair of navmesh polygons with the same filter skip the A* search. Only the corridor is
+/// shared, the point path is still smoothed from each unit's exact start and end position.
+/// Cached polygon refs carry the tile salt and must be validated by the caller.
+class TC_GAME_API PathCache
+{
+public:
+    struct Key
+    {
+        dtPolyRef StartPoly;
+        dtPolyRef EndPoly;
+        uint16 IncludeFlags;
+        uint16 ExcludeFlags;
+
+        bool operator==(Key const& right) const = default;
+    };
+
+    bool Find(Key const& key, dtPolyRef* path, uint32& length, uint32 maxLength);
+    void Store(Key const& key, dtPolyRef const* path, uint32 length);
+
+    std::size_t GetSize();
+    void Clear();
+
+private:
+    struct KeyHash
+    {
+        std::size_t operator()(Key const& key) const;
+    };
+
+    std::mutex _lock;
+    std::unordered_map<Key, std::vector<dtPolyRef>, KeyHash> _paths;
+};
+
+#endif // TRINITYCORE_PATH_CACHE_H
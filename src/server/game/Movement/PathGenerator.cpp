@@ -37,14 +37,6 @@ PathGenerator::PathGenerator(WorldObject const* owner) :
 
     TC_LOG_DEBUG("maps.mmaps", "++ PathGenerator::PathGenerator for {}", _source->GetGUID().ToString());
 
-    uint32 mapId = _source->GetMapId();
-    if (DisableMgr::IsPathfindingEnabled(mapId))
-    {
-        MMAP::MMapManager* mmap = MMAP::MMapFactory::createOrGetMMapManager();
-        _navMeshQuery = mmap->GetNavMeshQuery(mapId, _source->GetInstanceId());
-        _navMesh = _navMeshQuery ? _navMeshQuery->getAttachedNavMesh() : mmap->GetNavMesh(mapId);
-    }
-
     CreateFilter();
 }
 
@@ -73,6 +65,17 @@ bool PathGenerator::CalculatePath(float destX, float destY, float destZ, bool fo
 
     TC_LOG_DEBUG("maps.mmaps", "++ PathGenerator::CalculatePath() for {}", _source->GetGUID().ToString());
 
+    // the query is looked up on every calculation, consecutive updates of the same map may run on different threads
+    _navMesh = nullptr;
+    _navMeshQuery = nullptr;
+    uint32 mapId = _source->GetMapId();
+    if (DisableMgr::IsPathfindingEnabled(mapId))
+    {
+        MMAP::MMapManager* mmap = MMAP::MMapFactory::createOrGetMMapManager();
+        _navMeshQuery = mmap->GetNavMeshQuery(mapId);
+        _navMesh = _navMeshQuery ? _navMeshQuery->getAttachedNavMesh() : mmap->GetNavMesh(mapId);
+    }
+
     // make sure navMesh works - we can run on map w/o mmap
     // check if the start and end point have a .mmtile loaded (can we pass via not loaded tile on the way?)
     Unit const* _sourceUnit = _source->ToUnit();
@@ -493,15 +496,29 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
         }
         else
         {
-            dtResult = _navMeshQuery->findPath(
-                            startPoly,          // start polygon
-                            endPoly,            // end polygon
-                            startPoint,         // start position
-                            endPoint,           // end position
-                            &_filter,           // polygon search filter
-                            _pathPolyRefs,     // [out] path
-                            (int*)&_polyLength,
-                            MAX_PATH_LENGTH);   // max number of polygons in output path
+            // units chasing the same target usually start and end on the same polygons, share their corridor
+            PathCache::Key cacheKey{ startPoly, endPoly, _filter.getIncludeFlags(), _filter.getExcludeFlags() };
+            PathCache& pathCache = _source->GetMap()->GetPathCache();
+            if (pathCache.Find(cacheKey, _pathPolyRefs, _polyLength, MAX_PATH_LENGTH) && HaveValidPolyPath())
+            {
+                TC_LOG_DEBUG("maps.mmaps", "++ BuildPolyPath :: reusing cached poly path of length {}", _polyLength);
+                dtResult = DT_SUCCESS;
+            }
+            else
+            {
+                dtResult = _navMeshQuery->findPath(
+                                startPoly,          // start polygon
+                                endPoly,            // end polygon
+                                startPoint,         // start position
+                                endPoint,           // end position
+                                &_filter,           // polygon search filter
+                                _pathPolyRefs,     // [out] path
+                                (int*)&_polyLength,
+                                MAX_PATH_LENGTH);   // max number of polygons in output path
+
+                if (_polyLength && dtStatusSucceed(dtResult))
+                    pathCache.Store(cacheKey, _pathPolyRefs, _polyLength);
+            }
         }
 
         if (!_polyLength || dtStatusFailed(dtResult))
@@ -713,6 +730,16 @@ NavTerrainFlag PathGenerator::GetNavTerrain(float x, float y, float z)
     }
 }
 
+bool PathGenerator::HaveValidPolyPath() const
+{
+    // refs carry the tile salt, this fails once any tile of the corridor got unloaded or reloaded
+    for (uint32 i = 0; i < _polyLength; ++i)
+        if (!_navMesh->isValidPolyRef(_pathPolyRefs[i]))
+            return false;
+
+    return true;
+}
+
 bool PathGenerator::HaveTile(const G3D::Vector3& p) const
 {
     int tx = -1, ty = -1;
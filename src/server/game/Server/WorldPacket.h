@@ -22,6 +22,7 @@
 #include "Opcodes.h"
 #include "ByteBuffer.h"
 #include "Duration.h"
+#include "PacketStoragePool.h"
 
 class WorldPacket : public ByteBuffer
 {
@@ -31,7 +32,7 @@ class WorldPacket : public ByteBuffer
         {
         }
 
-        WorldPacket(uint16 opcode, size_t res = 200) : ByteBuffer(res),
+        WorldPacket(uint16 opcode, size_t res = 200) : ByteBuffer(PacketStoragePool::Acquire(res)),
             m_opcode(opcode) { }
 
         WorldPacket(WorldPacket&& packet) : ByteBuffer(std::move(packet)), m_opcode(packet.m_opcode)
@@ -42,8 +43,14 @@ class WorldPacket : public ByteBuffer
         {
         }
 
-        WorldPacket(WorldPacket const& right) : ByteBuffer(right), m_opcode(right.m_opcode)
+        WorldPacket(WorldPacket const& right) : ByteBuffer(PacketStoragePool::Acquire(right.size())), m_opcode(right.m_opcode)
         {
+            ByteBuffer::operator=(right);
+        }
+
+        ~WorldPacket()
+        {
+            PacketStoragePool::Release(std::move(_storage));
         }
 
         WorldPacket& operator=(WorldPacket const& right)
@@ -62,6 +69,7 @@ class WorldPacket : public ByteBuffer
             if (this != &right)
             {
                 m_opcode = right.m_opcode;
+                PacketStoragePool::Release(std::move(_storage));
                 ByteBuffer::operator=(std::move(right));
             }
 
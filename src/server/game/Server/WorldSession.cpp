@@ -59,6 +59,8 @@
 #include "WorldPacket.h"
 #include "WorldSocket.h"
 #include <boost/circular_buffer.hpp>
+#include <bit>
+#include <cstring>
 #include <zlib.h>
 
 namespace {
@@ -178,8 +180,8 @@ WorldSession::~WorldSession()
     delete _gameClient;
 
     ///- empty incoming packet queue
-    WorldPacket* packet = nullptr;
-    while (_recvQueue.next(packet))
+    DrainRecvQueue();
+    for (WorldPacket* packet : _recvPendingPackets)
         delete packet;
 
     LoginDatabase.PExecute("UPDATE account SET online = 0 WHERE id = {};", GetAccountId());     // One-time query
@@ -204,11 +206,26 @@ std::string WorldSession::GetPlayerInfo() const
 /// Send a packet to the client
 void WorldSession::SendPacket(WorldPacket const* packet)
 {
-    ASSERT(packet->GetOpcode() != NULL_OPCODE);
+    if (!m_Socket || !PrepareSendPacket(packet))
+        return;
+
+    m_Socket->SendPacket(*packet);
+}
 
-    if (!m_Socket)
+/// Send a packet to the client without copying its payload, the same packet may be queued on many sockets
+void WorldSession::SendPacket(std::shared_ptr<WorldPacket const> const& packet)
+{
+    if (!m_Socket || !PrepareSendPacket(packet.get()))
         return;
 
+    m_Socket->SendPacket(packet);
+}
+
+/// Statistics, script hooks and logging for a packet about to be sent, returns false if it must not be sent
+bool WorldSession::PrepareSendPacket(WorldPacket const* packet)
+{
+    ASSERT(packet->GetOpcode() != NULL_OPCODE);
+
 #ifdef TRINITY_DEBUG
     // Code for network use statistic
     static uint64 sendPacketCount = 0;
@@ -251,19 +268,57 @@ void WorldSession::SendPacket(WorldPacket const* packet)
         if (Eluna* e = plr->GetEluna())
         {
             if (!e->OnPacketSend(this, *packet))
-                return;
+                return false;
         }
     }
 #endif
 
     TC_LOG_TRACE("network.opcode", "S->C: {} {}", GetPlayerInfo(), GetOpcodeNameForLogging(static_cast<OpcodeServer>(packet->GetOpcode())));
-    m_Socket->SendPacket(*packet);
+    return true;
 }
 
 /// Add an incoming packet to the queue
 void WorldSession::QueuePacket(WorldPacket* new_packet)
 {
-    _recvQueue.add(new_packet);
+    _recvQueue.Enqueue(new_packet);
+}
+
+namespace
+{
+    // heartbeats only repeat the current position of the mover, when several of them are waiting
+    // back to back for the same mover only the newest one carries information
+    bool IsRedundantHeartbeat(WorldPacket const& previous, WorldPacket const& next)
+    {
+        if (previous.GetOpcode() != MSG_MOVE_HEARTBEAT || next.GetOpcode() != MSG_MOVE_HEARTBEAT)
+            return false;
+
+        if (previous.empty() || next.empty())
+            return false;
+
+        // both start with the packed guid of the mover
+        std::size_t guidSize = 1 + std::popcount(previous.contents()[0]);
+        if (previous.size() < guidSize || next.size() < guidSize)
+            return false;
+
+        return memcmp(previous.contents(), next.contents(), guidSize) == 0;
+    }
+}
+
+/// Moves all packets received by the network thread to the list processed by Update() in one batch
+void WorldSession::DrainRecvQueue()
+{
+    WorldPacket* packet = nullptr;
+    while (_recvQueue.Dequeue(packet))
+    {
+        if (!_recvPendingPackets.empty() && IsRedundantHeartbeat(*_recvPendingPackets.back(), *packet))
+        {
+            delete _recvPendingPackets.back();
+            _recvPendingPackets.back() = packet;
+            continue;
+        }
+
+        _recvPendingPackets.push_back(packet);
+    }
 }
 
 /// Logging helper for unexpected opcodes
@@ -304,8 +359,13 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
 
     constexpr uint32 MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE = 100;
 
-    while (m_Socket && _recvQueue.next(packet, updater))
+    DrainRecvQueue();
+
+    while (m_Socket && !_recvPendingPackets.empty() && updater.Process(_recvPendingPackets.front()))
     {
+        packet = _recvPendingPackets.front();
+        _recvPendingPackets.pop_front();
+
         OpcodeClient opcode = static_cast<OpcodeClient>(packet->GetOpcode());
         ClientOpcodeHandler const* opHandle = opcodeTable[opcode];
         TC_METRIC_DETAILED_TIMER("worldsession_update_opcode_time", TC_METRIC_TAG("opcode", opHandle->Name));
@@ -464,7 +524,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
 
     TC_METRIC_VALUE("processed_packets", processedPackets);
 
-    _recvQueue.readd(requeuePackets.begin(), requeuePackets.end());
+    _recvPendingPackets.insert(_recvPendingPackets.begin(), requeuePackets.begin(), requeuePackets.end());
 
     if (!updater.ProcessUnsafe()) // <=> updater is of type MapSessionFilter
     {
@@ -24,6 +24,7 @@
 #include "CryptoRandom.h"
 #include "IPLocation.h"
 #include "IpBanCheckConnectionInitializer.h"
+#include "PacketStoragePool.h"
 #include "PacketLog.h"
 #include "Random.h"
 #include "RBAC.h"
@@ -79,28 +80,29 @@ bool WorldSocket::Update()
         MessageBuffer buffer(_sendBufferSize);
         do
         {
-            ServerPktHeader header(queued->size() + 2, queued->GetOpcode());
+            WorldPacket const& packet = queued->GetPacket();
+            ServerPktHeader header(packet.size() + 2, packet.GetOpcode());
             if (queued->NeedsEncryption())
                 _authCrypt.EncryptSend(header.header, header.getHeaderLength());
 
-            if (buffer.GetRemainingSpace() < queued->size() + header.getHeaderLength())
+            if (buffer.GetRemainingSpace() < packet.size() + header.getHeaderLength())
             {
                 QueuePacket(std::move(buffer));
                 buffer.Resize(_sendBufferSize);
             }
 
-            if (buffer.GetRemainingSpace() >= queued->size() + header.getHeaderLength())
+            if (buffer.GetRemainingSpace() >= packet.size() + header.getHeaderLength())
             {
                 buffer.Write(header.header, header.getHeaderLength());
-                if (!queued->empty())
-                    buffer.Write(queued->contents(), queued->size());
+                if (!packet.empty())
+                    buffer.Write(packet.contents(), packet.size());
             }
             else    // single packet larger than buffer size
             {
-                MessageBuffer packetBuffer(queued->size() + header.getHeaderLength());
+                MessageBuffer packetBuffer(packet.size() + header.getHeaderLength());
                 packetBuffer.Write(header.header, header.getHeaderLength());
-                if (!queued->empty())
-                    packetBuffer.Write(queued->contents(), queued->size());
+                if (!packet.empty())
+                    packetBuffer.Write(packet.contents(), packet.size());
 
                 QueuePacket(std::move(packetBuffer));
             }
@@ -221,6 +223,7 @@ bool WorldSocket::ReadHeaderHandler()
     }
 
     header->size -= sizeof(header->cmd);
+    _packetBuffer = MessageBuffer(PacketStoragePool::Acquire(header->size));
     _packetBuffer.Resize(header->size);
     return true;
 }
@@ -418,6 +421,17 @@ void WorldSocket::SendPacket(WorldPacket const& packet)
     _bufferQueue.Enqueue(new EncryptablePacket(packet, _authCrypt.IsInitialized()));
 }
 
+void WorldSocket::SendPacket(std::shared_ptr<WorldPacket const> packet)
+{
+    if (!IsOpen())
+        return;
+
+    if (sPacketLog->CanLogPacket())
+        sPacketLog->LogPacket(*packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort());
+
+    _bufferQueue.Enqueue(new EncryptablePacket(std::move(packet), _authCrypt.IsInitialized()));
+}
+
 void WorldSocket::HandleAuthSession(WorldPacket& recvPacket)
 {
     std::shared_ptr<AuthSession> authSession = std::make_shared<AuthSession>();
@@ -26,22 +26,36 @@
 #include "WorldSession.h"
 #include "WorldPacketCrypt.h"
 #include "MPSCQueue.h"
+#include "Optional.h"
 #include <boost/asio/ip/tcp.hpp>
+#include <memory>
 
 using boost::asio::ip::tcp;
-class EncryptablePacket : public WorldPacket
+// Only the header of a 3.3.5 packet is encrypted, so queued packets can reference
+// an immutable payload that is shared between all sockets it is broadcast to
+class EncryptablePacket
 {
 public:
-    EncryptablePacket(WorldPacket const& packet, bool encrypt) : WorldPacket(packet), _encrypt(encrypt)
+    // single receiver, the queue entry keeps its own copy
+    EncryptablePacket(WorldPacket const& packet, bool encrypt) : _ownPacket(std::in_place, packet), _encrypt(encrypt)
     {
         SocketQueueLink.store(nullptr, std::memory_order_relaxed);
     }
 
+    // broadcast, every receiver references the same payload
+    EncryptablePacket(std::shared_ptr<WorldPacket const> packet, bool encrypt) : _sharedPacket(std::move(packet)), _encrypt(encrypt)
+    {
+        SocketQueueLink.store(nullptr, std::memory_order_relaxed);
+    }
+
+    WorldPacket const& GetPacket() const { return _sharedPacket ? *_sharedPacket : *_ownPacket; }
     bool NeedsEncryption() const { return _encrypt; }
 
     std::atomic<EncryptablePacket*> SocketQueueLink;
 
 private:
+    Optional<WorldPacket> _ownPacket;
+    std::shared_ptr<WorldPacket const> _sharedPacket;
     bool _encrypt;
 };
 
@@ -81,6 +95,7 @@ public:
     bool Update() override;
 
     void SendPacket(WorldPacket const& packet);
+    void SendPacket(std::shared_ptr<WorldPacket const> packet);
 
     void SetSendBufferSize(std::size_t sendBufferSize) { _sendBufferSize = sendBufferSize; }
 
@@ -1909,6 +1909,24 @@ void Spell::SearchAreaTargets(std::list<WorldObject*>& targets, float range, Pos
 
     float extraSearchRadius = range > 0.0f ? EXTRA_CELL_SEARCH_RADIUS : 0.0f;
     Trinity::WorldObjectSpellAreaTargetCheck check(range, position, m_caster, referer, m_spellInfo, selectionType, condList);
+
+    // unit only searches are answered by the map position index instead of visiting every object in the touched cells
+    if (range > 0.0f && range + extraSearchRadius <= SIZE_OF_GRIDS && !(containerTypeMask & ~(GRID_MAP_TYPE_MASK_CREATURE | GRID_MAP_TYPE_MASK_PLAYER)))
+    {
+        std::vector<Unit*> candidates;
+        m_caster->GetMap()->GetUnitPositionIndex().GetUnitsInRange(position->GetPositionX(), position->GetPositionY(), range + extraSearchRadius, candidates);
+        for (Unit* candidate : candidates)
+        {
+#ifdef TRINITY_DEBUG
+            m_caster->GetMap()->GetUnitPositionIndex().CheckPosition(candidate);
+#endif
+            uint32 typeMask = candidate->GetTypeId() == TYPEID_PLAYER ? GRID_MAP_TYPE_MASK_PLAYER : GRID_MAP_TYPE_MASK_CREATURE;
+            if ((containerTypeMask & typeMask) && check(candidate))
+                targets.push_back(candidate);
+        }
+        return;
+    }
+
     Trinity::WorldObjectListSearcher<Trinity::WorldObjectSpellAreaTargetCheck> searcher(m_caster, targets, check, containerTypeMask);
     searcher.i_phaseMask = PHASEMASK_ANYWHERE;
     SearchTargets<Trinity::WorldObjectListSearcher<Trinity::WorldObjectSpellAreaTargetCheck>>(searcher, containerTypeMask, m_caster, position, range + extraSearchRadius);
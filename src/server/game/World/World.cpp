@@ -92,9 +92,11 @@
 #include "ElunaConfig.h"
 #endif
 #include "WhoListStorage.h"
+#include "WorldLoadGraph.h"
 #include "WorldSession.h"
 
 #include <boost/asio/ip/address.hpp>
+#include <thread>
 
 TC_GAME_API std::atomic<bool> World::m_stopEvent(false);
 TC_GAME_API uint8 World::m_ExitCode = SHUTDOWN_EXIT_CODE;
@@ -666,6 +668,7 @@ void World::LoadConfigSettings(bool reload)
         TC_LOG_ERROR("server.loading", "Compression level ({}) must be in range 1..9. Using default compression level (1).", m_int_configs[CONFIG_COMPRESSION]);
         m_int_configs[CONFIG_COMPRESSION] = 1;
     }
+    m_int_configs[CONFIG_COMPRESSION_THRESHOLD] = sConfigMgr->GetIntDefault("Compression.Threshold", 100);
     m_bool_configs[CONFIG_ADDON_CHANNEL] = sConfigMgr->GetBoolDefault("AddonChannel", true);
     m_bool_configs[CONFIG_CLEAN_CHARACTER_DB] = sConfigMgr->GetBoolDefault("CleanCharacterDB", false);
     m_int_configs[CONFIG_PERSISTENT_CHARACTER_CLEAN_FLAGS] = sConfigMgr->GetIntDefault("PersistentCharacterCleanFlags", 0);
@@ -1416,6 +1419,7 @@ void World::LoadConfigSettings(bool reload)
 
     m_bool_configs[CONFIG_ENABLE_MMAPS] = sConfigMgr->GetBoolDefault("mmap.enablePathFinding", true);
     TC_LOG_INFO("server.loading", "WORLD: MMap data directory is: {}mmaps", m_dataPath);
+    MMAP::MMapFactory::createOrGetMMapManager()->setTileMemoryBudgetPerMap(std::size_t(sConfigMgr->GetIntDefault("mmap.tileMemoryBudgetPerMap", 64)) * 1024 * 1024);
 
     m_bool_configs[CONFIG_VMAP_INDOOR_CHECK] = sConfigMgr->GetBoolDefault("vmap.enableIndoorCheck", false);
     bool enableIndoor = sConfigMgr->GetBoolDefault("vmap.enableIndoorCheck", true);
@@ -1463,6 +1467,9 @@ void World::LoadConfigSettings(bool reload)
     m_bool_configs[CONFIG_SHOW_MUTE_IN_WORLD] = sConfigMgr->GetBoolDefault("ShowMuteInWorld", false);
     m_bool_configs[CONFIG_SHOW_BAN_IN_WORLD] = sConfigMgr->GetBoolDefault("ShowBanInWorld", false);
     m_int_configs[CONFIG_NUMTHREADS] = sConfigMgr->GetIntDefault("MapUpdate.Threads", 1);
+    m_int_configs[CONFIG_STARTUP_LOAD_THREADS] = sConfigMgr->GetIntDefault("StartupLoad.Threads", 0);
+    if (!m_int_configs[CONFIG_STARTUP_LOAD_THREADS])
+        m_int_configs[CONFIG_STARTUP_LOAD_THREADS] = std::max(1u, std::thread::hardware_concurrency());
     m_int_configs[CONFIG_MAX_RESULTS_LOOKUP_COMMANDS] = sConfigMgr->GetIntDefault("Command.LookupMaxResults", 0);
 
     // Warden
@@ -1993,33 +2000,98 @@ void World::SetInitialWorldSettings()
     TC_LOG_INFO("server.loading", "Loading Player level dependent mail rewards...");
     sObjectMgr->LoadMailLevelRewards();
 
-    // Loot tables
-    LoadLootTables();
+    ///- Load data that only reads the templates loaded above in parallel
+    ///  Every step writes its own stores, anything shared between two steps must be a declared dependency
+    {
+        WorldLoadGraph loadGraph;
+
+        // Loot tables
+        loadGraph.AddStep("Loot tables", { }, []() { LoadLootTables(); });
+
+        loadGraph.AddStep("Skill Discovery Table", { }, []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Skill Discovery Table...");
+            LoadSkillDiscoveryTable();
+        });
+
+        loadGraph.AddStep("Skill Extra Item Table", { }, []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Skill Extra Item Table...");
+            LoadSkillExtraItemTable();
+        });
+
+        loadGraph.AddStep("Skill Perfection Data Table", { }, []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Skill Perfection Data Table...");
+            LoadSkillPerfectItemTable();
+        });
+
+        loadGraph.AddStep("Skill Fishing base levels", { }, []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Skill Fishing base level requirements...");
+            sObjectMgr->LoadFishingBaseSkillLevel();
+        });
+
+        loadGraph.AddStep("Achievement Criteria", { }, []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Achievements...");
+            sAchievementMgr->LoadAchievementReferenceList();
+            TC_LOG_INFO("server.loading", "Loading Achievement Criteria Lists...");
+            sAchievementMgr->LoadAchievementCriteriaList();
+            TC_LOG_INFO("server.loading", "Loading Achievement Criteria Data...");
+            sAchievementMgr->LoadAchievementCriteriaData();         // must be after LoadAchievementCriteriaList
+        });
+
+        loadGraph.AddStep("Achievement Rewards", { }, []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Achievement Rewards...");
+            sAchievementMgr->LoadRewards();
+            TC_LOG_INFO("server.loading", "Loading Achievement Reward Locales...");
+            sAchievementMgr->LoadRewardLocales();                   // must be after LoadRewards
+        });
+
+        loadGraph.AddStep("Completed Achievements", { }, []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Completed Achievements...");
+            sAchievementMgr->LoadCompletedAchievements();
+        });
 
-    TC_LOG_INFO("server.loading", "Loading Skill Discovery Table...");
-    LoadSkillDiscoveryTable();
+        loadGraph.AddStep("Trainers", { }, []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Trainers...");   // must be after LoadCreatureTemplates
+            sObjectMgr->LoadTrainers();
 
-    TC_LOG_INFO("server.loading", "Loading Skill Extra Item Table...");
-    LoadSkillExtraItemTable();
+            TC_LOG_INFO("server.loading", "Loading Creature default trainers...");
+            sObjectMgr->LoadCreatureDefaultTrainers();
+        });
 
-    TC_LOG_INFO("server.loading", "Loading Skill Perfection Data Table...");
-    LoadSkillPerfectItemTable();
+        loadGraph.AddStep("Gossip menus", { "Trainers" }, []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Gossip menu...");
+            sObjectMgr->LoadGossipMenu();
 
-    TC_LOG_INFO("server.loading", "Loading Skill Fishing base level requirements...");
-    sObjectMgr->LoadFishingBaseSkillLevel();
+            TC_LOG_INFO("server.loading", "Loading Gossip menu options...");
+            sObjectMgr->LoadGossipMenuItems();
+        });
 
-    TC_LOG_INFO("server.loading", "Loading Achievements...");
-    sAchievementMgr->LoadAchievementReferenceList();
-    TC_LOG_INFO("server.loading", "Loading Achievement Criteria Lists...");
-    sAchievementMgr->LoadAchievementCriteriaList();
-    TC_LOG_INFO("server.loading", "Loading Achievement Criteria Data...");
-    sAchievementMgr->LoadAchievementCriteriaData();
-    TC_LOG_INFO("server.loading", "Loading Achievement Rewards...");
-    sAchievementMgr->LoadRewards();
-    TC_LOG_INFO("server.loading", "Loading Achievement Reward Locales...");
-    sAchievementMgr->LoadRewardLocales();
-    TC_LOG_INFO("server.loading", "Loading Completed Achievements...");
-    sAchievementMgr->LoadCompletedAchievements();
+        loadGraph.AddStep("Waypoints", { }, []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Waypoints...");
+            sWaypointMgr->Load();
+        });
+
+        loadGraph.AddStep("Creature Texts", { }, []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Creature Texts...");
+            sCreatureTextMgr->LoadCreatureTexts();
+
+            TC_LOG_INFO("server.loading", "Loading Creature Text Locales...");
+            sCreatureTextMgr->LoadCreatureTextLocales();
+        });
+
+        // every step queries the world database synchronously, threads beyond its connections would only wait for one
+        loadGraph.Run(std::min<uint32>(getIntConfig(CONFIG_STARTUP_LOAD_THREADS), std::max<uint32>(1, WorldDatabase.GetSynchThreadCount())));
+    }
 
     ///- Load dynamic data tables from the database
     TC_LOG_INFO("server.loading", "Loading Item Auctions...");
@@ -2049,24 +2121,9 @@ void World::SetInitialWorldSettings()
     TC_LOG_INFO("server.loading", "Loading GameTeleports...");
     sObjectMgr->LoadGameTele();
 
-    TC_LOG_INFO("server.loading", "Loading Trainers...");       // must be after LoadCreatureTemplates
-    sObjectMgr->LoadTrainers();
-
-    TC_LOG_INFO("server.loading", "Loading Creature default trainers...");
-    sObjectMgr->LoadCreatureDefaultTrainers();
-
-    TC_LOG_INFO("server.loading", "Loading Gossip menu...");
-    sObjectMgr->LoadGossipMenu();
-
-    TC_LOG_INFO("server.loading", "Loading Gossip menu options...");
-    sObjectMgr->LoadGossipMenuItems();                           // must be after LoadTrainers
-
     TC_LOG_INFO("server.loading", "Loading Vendors...");
     sObjectMgr->LoadVendors();                                   // must be after load CreatureTemplate and ItemTemplate
 
-    TC_LOG_INFO("server.loading", "Loading Waypoints...");
-    sWaypointMgr->Load();
-
     TC_LOG_INFO("server.loading", "Loading Creature Formations...");
     sFormationMgr->LoadCreatureFormations();
 
@@ -2118,12 +2175,6 @@ void World::SetInitialWorldSettings()
     TC_LOG_INFO("server.loading", "Loading spell script names...");
     sObjectMgr->LoadSpellScriptNames();
 
-    TC_LOG_INFO("server.loading", "Loading Creature Texts...");
-    sCreatureTextMgr->LoadCreatureTexts();
-
-    TC_LOG_INFO("server.loading", "Loading Creature Text Locales...");
-    sCreatureTextMgr->LoadCreatureTextLocales();
-
 #ifdef ELUNA
     if (sElunaConfig->IsElunaEnabled())
     {
@@ -0,0 +1,122 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WorldLoadGraph.h"
+#include "Errors.h"
+#include "Log.h"
+#include "ThreadPool.h"
+#include "Timer.h"
+#include <algorithm>
+#include <numeric>
+
+void WorldLoadGraph::AddStep(std::string_view name, std::initializer_list<std::string_view> dependencies, LoadFunction load)
+{
+    ASSERT(FindStep(name) == _steps.size(), "Load step %s was added twice", std::string(name).c_str());
+
+    Step& step = _steps.emplace_back();
+    step.Name = name;
+    step.Dependencies.assign(dependencies.begin(), dependencies.end());
+    step.Load = std::move(load);
+}
+
+std::size_t WorldLoadGraph::FindStep(std::string_view name) const
+{
+    return std::find_if(_steps.begin(), _steps.end(), [name](Step const& step) { return step.Name == name; }) - _steps.begin();
+}
+
+void WorldLoadGraph::Run(uint32 threads)
+{
+    uint32 oldMSTime = getMSTime();
+
+    // dependencies may be declared on steps added later, resolve them only now
+    for (std::size_t i = 0; i < _steps.size(); ++i)
+    {
+        for (std::string const& dependency : _steps[i].Dependencies)
+        {
+            std::size_t dependencyIndex = FindStep(dependency);
+            ASSERT(dependencyIndex < _steps.size(), "Load step %s depends on unknown step %s", _steps[i].Name.c_str(), dependency.c_str());
+            _steps[dependencyIndex].Dependants.push_back(i);
+            ++_steps[i].PendingDependencies;
+        }
+    }
+
+    // reject cycles up front, a step stuck behind one would silently never load
+    {
+        std::vector<uint32> pending(_steps.size());
+        std::vector<std::size_t> ready;
+        for (std::size_t i = 0; i < _steps.size(); ++i)
+            if (!(pending[i] = _steps[i].PendingDependencies))
+                ready.push_back(i);
+
+        std::size_t ordered = 0;
+        while (!ready.empty())
+        {
+            std::size_t index = ready.back();
+            ready.pop_back();
+            ++ordered;
+            for (std::size_t dependant : _steps[index].Dependants)
+                if (!--pending[dependant])
+                    ready.push_back(dependant);
+        }
+
+        ASSERT(ordered == _steps.size(), "Load steps contain a dependency cycle");
+    }
+
+    {
+        Trinity::ThreadPool pool(std::max<std::size_t>(1, std::min<std::size_t>(threads, _steps.size())));
+
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            for (std::size_t i = 0; i < _steps.size(); ++i)
+                if (!_steps[i].PendingDependencies)
+                    pool.PostWork([this, &pool, i]() { ExecuteStep(pool, i); });
+        }
+
+        pool.Join();
+    }
+
+    LogTimings(GetMSTimeDiffToNow(oldMSTime));
+}
+
+void WorldLoadGraph::ExecuteStep(Trinity::ThreadPool& pool, std::size_t index)
+{
+    Step& step = _steps[index];
+    uint32 oldMSTime = getMSTime();
+    step.Load();
+    step.LoadTime = GetMSTimeDiffToNow(oldMSTime);
+
+    std::lock_guard<std::mutex> lock(_lock);
+    for (std::size_t dependant : step.Dependants)
+        if (!--_steps[dependant].PendingDependencies)
+            pool.PostWork([this, &pool, dependant]() { ExecuteStep(pool, dependant); });
+}
+
+void WorldLoadGraph::LogTimings(uint32 totalTime) const
+{
+    std::vector<Step const*> steps;
+    steps.reserve(_steps.size());
+    for (Step const& step : _steps)
+        steps.push_back(&step);
+
+    std::sort(steps.begin(), steps.end(), [](Step const* left, Step const* right) { return left->LoadTime > right->LoadTime; });
+
+    uint32 sequentialTime = std::accumulate(steps.begin(), steps.end(), uint32(0), [](uint32 sum, Step const* step) { return sum + step->LoadTime; });
+
+    TC_LOG_INFO("server.loading", ">> Loaded {} load steps in {} ms ({} ms when loaded one after another)", uint32(steps.size()), totalTime, sequentialTime);
+    for (Step const* step : steps)
+        TC_LOG_INFO("server.loading", "   {:<32} {:>7} ms", step->Name, step->LoadTime);
+}
@@ -0,0 +1,66 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_WORLD_LOAD_GRAPH_H
+#define TRINITY_WORLD_LOAD_GRAPH_H
+
+#include "Define.h"
+#include <functional>
+#include <initializer_list>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Trinity
+{
+class ThreadPool;
+}
+
+/// Runs a set of startup load steps on a thread pool, starting each step as soon as
+/// all steps it depends on have finished. Steps must only write to their own stores
+/// and only read stores that were loaded before the graph runs or by a dependency.
+class TC_GAME_API WorldLoadGraph
+{
+public:
+    typedef std::function<void()> LoadFunction;
+
+    void AddStep(std::string_view name, std::initializer_list<std::string_view> dependencies, LoadFunction load);
+
+    /// Blocks until every step has been loaded, then logs how long each one took
+    void Run(uint32 threads);
+
+private:
+    struct Step
+    {
+        std::string Name;
+        std::vector<std::string> Dependencies;
+        std::vector<std::size_t> Dependants;
+        uint32 PendingDependencies = 0;
+        LoadFunction Load;
+        uint32 LoadTime = 0;
+    };
+
+    std::size_t FindStep(std::string_view name) const;
+    void ExecuteStep(Trinity::ThreadPool& pool, std::size_t index);
+    void LogTimings(uint32 totalTime) const;
+
+    std::vector<Step> _steps;
+    std::mutex _lock;
+};
+
+#endif // TRINITY_WORLD_LOAD_GRAPH_H
@@ -22,16 +22,20 @@
 #include "Log.h"
 #include "MessageBuffer.h"
 #include "SocketConnectionInitializer.h"
+#include <boost/asio/buffer.hpp>
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <boost/container/static_vector.hpp>
 #include <atomic>
+#include <deque>
 #include <memory>
-#include <queue>
 #include <type_traits>
 
 using boost::asio::ip::tcp;
 
 #define READ_BLOCK_SIZE 4096
+// max number of queued buffers handed to a single (vectored) write call, IOV_MAX is at least 16
+#define WRITE_GATHER_BUFFER_COUNT 16
 #ifdef BOOST_ASIO_HAS_IOCP
 #define TC_SOCKET_USE_IOCP
 #endif
@@ -179,7 +183,7 @@ public:
 
     void QueuePacket(MessageBuffer&& buffer)
     {
-        _writeQueue.push(std::move(buffer));
+        _writeQueue.push_back(std::move(buffer));
 
 #ifdef TC_SOCKET_USE_IOCP
         AsyncProcessQueue();
@@ -232,8 +236,7 @@ protected:
         _isWritingAsync = true;
 
 #ifdef TC_SOCKET_USE_IOCP
-        MessageBuffer& buffer = _writeQueue.front();
-        _socket.async_write_some(boost::asio::buffer(buffer.GetReadPointer(), buffer.GetActiveSize()),
+        _socket.async_write_some(GetWriteQueueBuffers(),
             [self = this->shared_from_this()](boost::system::error_code const& error, std::size_t transferedBytes)
             {
                 self->WriteHandler(error, transferedBytes);
@@ -259,6 +262,40 @@ protected:
     }
 
 private:
+    using WriteQueueBuffers = boost::container::static_vector<boost::asio::const_buffer, WRITE_GATHER_BUFFER_COUNT>;
+
+    // gathers the front of the write queue so that many small queued buffers go out in a single writev/WSASend
+    WriteQueueBuffers GetWriteQueueBuffers()
+    {
+        WriteQueueBuffers buffers;
+        for (MessageBuffer& buffer : _writeQueue)
+        {
+            if (buffers.size() == buffers.capacity())
+                break;
+
+            buffers.emplace_back(buffer.GetReadPointer(), buffer.GetActiveSize());
+        }
+
+        return buffers;
+    }
+
+    // removes fully written buffers from the queue and advances the partially written one
+    void WriteQueueCompleted(std::size_t transferredBytes)
+    {
+        while (transferredBytes && !_writeQueue.empty())
+        {
+            MessageBuffer& buffer = _writeQueue.front();
+            if (transferredBytes < buffer.GetActiveSize())
+            {
+                buffer.ReadCompleted(transferredBytes);
+                return;
+            }
+
+            transferredBytes -= buffer.GetActiveSize();
+            _writeQueue.pop_front();
+        }
+    }
+
     bool ReadHandlerInternal(boost::system::error_code const& error, size_t transferredBytes)
     {
         if (error)
@@ -278,9 +315,7 @@ private:
         if (!error)
         {
             _isWritingAsync = false;
-            _writeQueue.front().ReadCompleted(transferedBytes);
-            if (!_writeQueue.front().GetActiveSize())
-                _writeQueue.pop();
+            WriteQueueCompleted(transferedBytes);
 
             if (!_writeQueue.empty())
                 AsyncProcessQueue();
@@ -304,37 +339,36 @@ private:
         if (_writeQueue.empty())
             return false;
 
-        MessageBuffer& queuedMessage = _writeQueue.front();
+        WriteQueueBuffers buffers = GetWriteQueueBuffers();
 
-        std::size_t bytesToSend = queuedMessage.GetActiveSize();
+        std::size_t bytesToSend = boost::asio::buffer_size(buffers);
 
         boost::system::error_code error;
-        std::size_t bytesSent = _socket.write_some(boost::asio::buffer(queuedMessage.GetReadPointer(), bytesToSend), error);
+        std::size_t bytesSent = _socket.write_some(buffers, error);
 
         if (error)
         {
             if (error == boost::asio::error::would_block || error == boost::asio::error::try_again)
                 return AsyncProcessQueue();
 
-            _writeQueue.pop();
+            _writeQueue.pop_front();
             if (_openState == OpenState_Closing && _writeQueue.empty())
                 CloseSocket();
             return false;
         }
         else if (bytesSent == 0)
         {
-            _writeQueue.pop();
+            _writeQueue.pop_front();
             if (_openState == OpenState_Closing && _writeQueue.empty())
                 CloseSocket();
             return false;
         }
-        else if (bytesSent < bytesToSend) // now n > 0
-        {
-            queuedMessage.ReadCompleted(bytesSent);
+
+        WriteQueueCompleted(bytesSent);
+
+        if (bytesSent < bytesToSend) // now n > 0
             return AsyncProcessQueue();
-        }
 
-        _writeQueue.pop();
         if (_openState == OpenState_Closing && _writeQueue.empty())
             CloseSocket();
         return !_writeQueue.empty();
@@ -348,7 +382,7 @@ private:
     uint16 _remotePort = 0;
 
     MessageBuffer _readBuffer = MessageBuffer(READ_BLOCK_SIZE);
-    std::queue<MessageBuffer> _writeQueue;
+    std::deque<MessageBuffer> _writeQueue;
 
     // Socket open state "enum" (not enum to enable integral std::atomic api)
     static constexpr uint8 OpenState_Open       = 0x0;
@@ -92,6 +92,10 @@ class TC_SHARED_API ByteBuffer
 
         ByteBuffer(MessageBuffer&& buffer);
 
+        explicit ByteBuffer(std::vector<uint8>&& storage) noexcept : _rpos(0), _wpos(0), _storage(std::move(storage))
+        {
+        }
+
         ByteBuffer& operator=(ByteBuffer const& right)
         {
             if (this != &right)
@@ -0,0 +1,180 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PacketStoragePool.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
+
+namespace
+{
+    struct SizeClass
+    {
+        std::size_t Capacity;
+        std::size_t ThreadCacheLimit;
+        std::size_t SharedLimit;
+    };
+
+    constexpr std::array<SizeClass, 5> SizeClasses =
+    { {
+        { 256,   128, 4096 },
+        { 1024,  64,  2048 },
+        { 4096,  32,  512 },
+        { 16384, 8,   128 },
+        { 65536, 2,   32 },
+    } };
+
+    // number of buffers moved between a thread cache and the shared list at once
+    constexpr std::size_t TransferBatchSize = 16;
+
+    typedef std::vector<std::vector<uint8>> StorageList;
+
+    struct SharedSizeClass
+    {
+        std::mutex Lock;
+        StorageList Storage;
+    };
+
+    std::array<SharedSizeClass, SizeClasses.size()> SharedStorage;
+
+    // set once the calling thread's cache was destroyed, packets freed after that
+    // (static destructors of the main thread) bypass the pool
+    thread_local bool ThreadStorageDestroyed = false;
+
+    struct ThreadStorageCache
+    {
+        ~ThreadStorageCache() { ThreadStorageDestroyed = true; }
+
+        std::array<StorageList, SizeClasses.size()> Lists;
+    };
+
+    thread_local ThreadStorageCache ThreadStorage;
+
+    std::atomic<uint64> Hits;
+    std::atomic<uint64> Misses;
+    std::atomic<uint64> Recycled;
+    std::atomic<uint64> Discarded;
+
+    // smallest class able to hold `capacity` bytes
+    std::size_t GetAcquireClass(std::size_t capacity)
+    {
+        std::size_t index = 0;
+        while (index < SizeClasses.size() && SizeClasses[index].Capacity < capacity)
+            ++index;
+        return index;
+    }
+
+    // largest class whose requests a buffer of `capacity` bytes can serve
+    std::size_t GetReleaseClass(std::size_t capacity)
+    {
+        std::size_t index = SizeClasses.size();
+        while (index > 0 && SizeClasses[index - 1].Capacity > capacity)
+            --index;
+        return index - 1;
+    }
+}
+
+std::vector<uint8> PacketStoragePool::Acquire(std::size_t capacity)
+{
+    std::vector<uint8> storage;
+    if (!capacity)
+        return storage;
+
+    std::size_t sizeClass = GetAcquireClass(capacity);
+    if (sizeClass >= SizeClasses.size() || ThreadStorageDestroyed)
+    {
+        Misses.fetch_add(1, std::memory_order_relaxed);
+        storage.reserve(capacity);
+        return storage;
+    }
+
+    StorageList& cache = ThreadStorage.Lists[sizeClass];
+    if (cache.empty())
+    {
+        SharedSizeClass& shared = SharedStorage[sizeClass];
+        std::lock_guard<std::mutex> lock(shared.Lock);
+        std::size_t count = std::min(shared.Storage.size(), TransferBatchSize);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            cache.push_back(std::move(shared.Storage.back()));
+            shared.Storage.pop_back();
+        }
+    }
+
+    if (cache.empty())
+    {
+        Misses.fetch_add(1, std::memory_order_relaxed);
+        storage.reserve(SizeClasses[sizeClass].Capacity);
+        return storage;
+    }
+
+    Hits.fetch_add(1, std::memory_order_relaxed);
+    storage = std::move(cache.back());
+    cache.pop_back();
+    return storage;
+}
+
+void PacketStoragePool::Release(std::vector<uint8>&& storage)
+{
+    std::size_t capacity = storage.capacity();
+    if (!capacity)
+        return;
+
+    // buffers grown far beyond the largest class are not worth holding on to
+    if (capacity < SizeClasses.front().Capacity || capacity > SizeClasses.back().Capacity * 2 || ThreadStorageDestroyed)
+    {
+        Discarded.fetch_add(1, std::memory_order_relaxed);
+        std::vector<uint8>().swap(storage);
+        return;
+    }
+
+    std::size_t sizeClass = GetReleaseClass(capacity);
+    StorageList& cache = ThreadStorage.Lists[sizeClass];
+    if (cache.size() >= SizeClasses[sizeClass].ThreadCacheLimit)
+    {
+        SharedSizeClass& shared = SharedStorage[sizeClass];
+        std::lock_guard<std::mutex> lock(shared.Lock);
+        std::size_t count = std::min(cache.size(), TransferBatchSize);
+        for (std::size_t i = 0; i < count && shared.Storage.size() < SizeClasses[sizeClass].SharedLimit; ++i)
+        {
+            shared.Storage.push_back(std::move(cache.back()));
+            cache.pop_back();
+        }
+    }
+
+    if (cache.size() >= SizeClasses[sizeClass].ThreadCacheLimit)
+    {
+        Discarded.fetch_add(1, std::memory_order_relaxed);
+        std::vector<uint8>().swap(storage);
+        return;
+    }
+
+    Recycled.fetch_add(1, std::memory_order_relaxed);
+    storage.clear();
+    cache.push_back(std::move(storage));
+}
+
+PacketStoragePool::Statistics PacketStoragePool::GetStatistics()
+{
+    Statistics statistics;
+    statistics.Hits = Hits.load(std::memory_order_relaxed);
+    statistics.Misses = Misses.load(std::memory_order_relaxed);
+    statistics.Recycled = Recycled.load(std::memory_order_relaxed);
+    statistics.Discarded = Discarded.load(std::memory_order_relaxed);
+    return statistics;
+}
@@ -0,0 +1,47 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_PACKET_STORAGE_POOL_H
+#define TRINITYCORE_PACKET_STORAGE_POOL_H
+
+#include "Define.h"
+#include <vector>
+
+/// Recycles packet byte storage by size class.
+/// Every thread keeps a small cache of released buffers, overflowing into a shared list so
+/// buffers allocated by network threads and released by map threads are reused as well.
+class TC_SHARED_API PacketStoragePool
+{
+public:
+    struct Statistics
+    {
+        uint64 Hits = 0;        // Acquire served from a cached buffer
+        uint64 Misses = 0;      // Acquire had to allocate
+        uint64 Recycled = 0;    // Release kept the buffer for reuse
+        uint64 Discarded = 0;   // Release freed the buffer (too small, too large or pool full)
+    };
+
+    /// Returns an empty vector with at least `capacity` bytes reserved
+    static std::vector<uint8> Acquire(std::size_t capacity);
+
+    /// Hands the storage of a packet that is going away back to the pool
+    static void Release(std::vector<uint8>&& storage);
+
+    static Statistics GetStatistics();
+};
+
+#endif // TRINITYCORE_PACKET_STORAGE_POOL_H
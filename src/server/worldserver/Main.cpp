@@ -32,10 +32,12 @@
 #include "Locales.h"
 #include "MapManager.h"
 #include "Metric.h"
+#include "MMapFactory.h"
 #include "MySQLThreading.h"
 #include "ObjectAccessor.h"
 #include "OpenSSLCrypto.h"
 #include "OutdoorPvP/OutdoorPvPMgr.h"
+#include "PacketStoragePool.h"
 #include "ProcessPriority.h"
 #include "RASession.h"
 #include "RealmList.h"
@@ -300,6 +302,18 @@ int main(int argc, char** argv)
         TC_METRIC_VALUE("db_queue_login", uint64(LoginDatabase.QueueSize()));
         TC_METRIC_VALUE("db_queue_character", uint64(CharacterDatabase.QueueSize()));
         TC_METRIC_VALUE("db_queue_world", uint64(WorldDatabase.QueueSize()));
+
+        PacketStoragePool::Statistics packetPool = PacketStoragePool::GetStatistics();
+        TC_METRIC_VALUE("packet_pool_hits", packetPool.Hits);
+        TC_METRIC_VALUE("packet_pool_misses", packetPool.Misses);
+        TC_METRIC_VALUE("packet_pool_recycled", packetPool.Recycled);
+        TC_METRIC_VALUE("packet_pool_discarded", packetPool.Discarded);
+
+        MMAP::MMapManager::TileCacheStatistics mmapTiles = MMAP::MMapFactory::createOrGetMMapManager()->getTileCacheStatistics();
+        TC_METRIC_VALUE("mmap_tile_hits", mmapTiles.Hits);
+        TC_METRIC_VALUE("mmap_tile_misses", mmapTiles.Misses);
+        TC_METRIC_VALUE("mmap_tile_evictions", mmapTiles.Evictions);
+        TC_METRIC_VALUE("mmap_tile_resident_bytes", mmapTiles.ResidentBytes);
     });
 
     TC_METRIC_EVENT("events", "Worldserver started", "");
@@ -16,17 +16,20 @@
  */
 
 #include "MapBuilder.h"
+#include "CryptoHash.h"
 #include "IntermediateValues.h"
 #include "MapDefines.h"
 #include "MapTree.h"
 #include "ModelInstance.h"
 #include "PathCommon.h"
 #include "StringFormat.h"
+#include "Util.h"
 #include "VMapFactory.h"
 #include "VMapManager2.h"
 #include <DetourCommon.h>
 #include <DetourNavMesh.h>
 #include <DetourNavMeshBuilder.h>
+#include <boost/filesystem/operations.hpp>
 #include <climits>
 
 namespace MMAP
@@ -469,12 +472,6 @@ namespace MMAP
     /**************************************************************************/
     void TileBuilder::buildTile(uint32 mapID, uint32 tileX, uint32 tileY, dtNavMesh* navMesh)
     {
-        if(shouldSkipTile(mapID, tileX, tileY))
-        {
-            ++m_mapBuilder->m_totalTilesProcessed;
-            return;
-        }
-
         printf("%u%% [Map %03i] Building tile [%02u,%02u]\n", m_mapBuilder->currentPercentageDone(), mapID, tileX, tileY);
 
         MeshData meshData;
@@ -513,8 +510,17 @@ namespace MMAP
 
         m_terrainBuilder->loadOffMeshConnections(mapID, tileX, tileY, meshData, m_mapBuilder->m_offMeshFilePath);
 
+        // an interrupted or repeated run only rebuilds tiles whose input geometry or settings changed
+        std::string inputHash = getInputHash(meshData, bmin, bmax);
+        if (shouldSkipTile(mapID, tileX, tileY, inputHash))
+        {
+            printf("%u%% [Map %03i] Tile [%02u,%02u] is up to date\n", m_mapBuilder->currentPercentageDone(), mapID, tileX, tileY);
+            ++m_mapBuilder->m_totalTilesProcessed;
+            return;
+        }
+
         // build navmesh tile
-        buildMoveMapTile(mapID, tileX, tileY, meshData, bmin, bmax, navMesh);
+        buildMoveMapTile(mapID, tileX, tileY, meshData, bmin, bmax, navMesh, inputHash);
 
         ++m_mapBuilder->m_totalTilesProcessed;
     }
@@ -594,7 +600,7 @@ namespace MMAP
     /**************************************************************************/
     void TileBuilder::buildMoveMapTile(uint32 mapID, uint32 tileX, uint32 tileY,
         MeshData &meshData, float bmin[3], float bmax[3],
-        dtNavMesh* navMesh)
+        dtNavMesh* navMesh, std::string const& inputHash)
     {
         // console output
         char tileString[20];
@@ -886,12 +892,13 @@ namespace MMAP
                 break;
             }
 
-            // file output
+            // file output, written next to the final name first so an interrupted run never leaves a truncated tile behind
             std::string fileName = Trinity::StringFormat("mmaps/{:03}{:02}{:02}.mmtile", mapID, tileY, tileX);
-            FILE* file = fopen(fileName.c_str(), "wb");
+            std::string tempFileName = fileName + ".tmp";
+            FILE* file = fopen(tempFileName.c_str(), "wb");
             if (!file)
             {
-                perror(Trinity::StringFormat("[Map {:03}] Failed to open {} for writing!\n", mapID, fileName).c_str());
+                perror(Trinity::StringFormat("[Map {:03}] Failed to open {} for writing!\n", mapID, tempFileName).c_str());
                 navMesh->removeTile(tileRef, nullptr, nullptr);
                 break;
             }
@@ -913,6 +920,13 @@ namespace MMAP
             fwrite(navData, sizeof(unsigned char), navDataSize, file);
             fclose(file);
 
+            boost::system::error_code renameError;
+            boost::filesystem::rename(tempFileName, fileName, renameError);
+            if (renameError)
+                printf("%s Failed to move %s to %s: %s\n", tileString, tempFileName.c_str(), fileName.c_str(), renameError.message().c_str());
+            else if (!inputHash.empty())
+                writeInputHash(mapID, tileX, tileY, inputHash);
+
             // now that tile is written to disk, we can unload it
             navMesh->removeTile(tileRef, nullptr, nullptr);
         }
@@ -1055,7 +1069,7 @@ namespace MMAP
     }
 
     /**************************************************************************/
-    bool TileBuilder::shouldSkipTile(uint32 mapID, uint32 tileX, uint32 tileY) const
+    bool TileBuilder::shouldSkipTile(uint32 mapID, uint32 tileX, uint32 tileY, std::string const& inputHash) const
     {
         std::string fileName = Trinity::StringFormat("mmaps/{:03}{:02}{:02}.mmtile", mapID, tileY, tileX);
         FILE* file = fopen(fileName.c_str(), "rb");
@@ -1074,7 +1088,75 @@ namespace MMAP
         if (header.mmapVersion != MMAP_VERSION)
             return false;
 
-        return true;
+        file = fopen((fileName + ".hash").c_str(), "rb");
+        if (!file)
+            return false;
+
+        char storedHash[Trinity::Crypto::SHA256::DIGEST_LENGTH * 2];
+        count = fread(storedHash, sizeof(storedHash), 1, file);
+        fclose(file);
+        if (count != 1)
+            return false;
+
+        return inputHash.compare(0, std::string::npos, storedHash, sizeof(storedHash)) == 0;
+    }
+
+    void TileBuilder::writeInputHash(uint32 mapID, uint32 tileX, uint32 tileY, std::string const& inputHash) const
+    {
+        std::string fileName = Trinity::StringFormat("mmaps/{:03}{:02}{:02}.mmtile.hash", mapID, tileY, tileX);
+        std::string tempFileName = fileName + ".tmp";
+        FILE* file = fopen(tempFileName.c_str(), "wb");
+        if (!file)
+        {
+            perror(Trinity::StringFormat("[Map {:03}] Failed to open {} for writing!\n", mapID, tempFileName).c_str());
+            return;
+        }
+
+        fwrite(inputHash.data(), sizeof(char), inputHash.size(), file);
+        fclose(file);
+
+        boost::system::error_code renameError;
+        boost::filesystem::rename(tempFileName, fileName, renameError);
+    }
+
+    std::string TileBuilder::getInputHash(MeshData const& meshData, float const* bmin, float const* bmax) const
+    {
+        Trinity::Crypto::SHA256 hash;
+
+        auto hashArray = [&hash](auto const& array)
+        {
+            uint32 size = uint32(array.size());
+            hash.UpdateData(reinterpret_cast<uint8 const*>(&size), sizeof(size));
+            if (size)
+                hash.UpdateData(reinterpret_cast<uint8 const*>(array.getCArray()), size * sizeof(array[0]));
+        };
+
+        hashArray(meshData.solidVerts);
+        hashArray(meshData.solidTris);
+        hashArray(meshData.liquidVerts);
+        hashArray(meshData.liquidTris);
+        hashArray(meshData.liquidType);
+        hashArray(meshData.offMeshConnections);
+        hashArray(meshData.offMeshConnectionRads);
+        hashArray(meshData.offMeshConnectionDirs);
+        hashArray(meshData.offMeshConnectionsAreas);
+        hashArray(meshData.offMeshConnectionsFlags);
+
+        hash.UpdateData(reinterpret_cast<uint8 const*>(bmin), 3 * sizeof(float));
+        hash.UpdateData(reinterpret_cast<uint8 const*>(bmax), 3 * sizeof(float));
+
+        // generator settings that shape the tile without showing up in the input geometry
+        float maxWalkableAngle = m_mapBuilder->m_maxWalkableAngle.value_or(-1.0f);
+        float maxWalkableAngleNotSteep = m_mapBuilder->m_maxWalkableAngleNotSteep.value_or(-1.0f);
+        uint32 versions[2] = { MMAP_VERSION, uint32(DT_NAVMESH_VERSION) };
+        uint8 flags[2] = { uint8(m_bigBaseUnit), uint8(m_terrainBuilder->usesLiquids()) };
+        hash.UpdateData(reinterpret_cast<uint8 const*>(&maxWalkableAngle), sizeof(maxWalkableAngle));
+        hash.UpdateData(reinterpret_cast<uint8 const*>(&maxWalkableAngleNotSteep), sizeof(maxWalkableAngleNotSteep));
+        hash.UpdateData(reinterpret_cast<uint8 const*>(versions), sizeof(versions));
+        hash.UpdateData(flags, sizeof(flags));
+
+        hash.Finalize();
+        return ByteArrayToHexStr(hash.GetDigest());
     }
 
     rcConfig MapBuilder::GetMapSpecificConfig(uint32 mapID, float bmin[3], float bmax[3], const TileConfig &tileConfig) const
@@ -126,9 +126,13 @@ namespace MMAP
                 MeshData& meshData,
                 float bmin[3],
                 float bmax[3],
-                dtNavMesh* navMesh);
+                dtNavMesh* navMesh,
+                std::string const& inputHash = {});
 
-            bool shouldSkipTile(uint32 mapID, uint32 tileX, uint32 tileY) const;
+            // true if the tile on disk was built by this generator version from the same input
+            bool shouldSkipTile(uint32 mapID, uint32 tileX, uint32 tileY, std::string const& inputHash) const;
+            void writeInputHash(uint32 mapID, uint32 tileX, uint32 tileY, std::string const& inputHash) const;
+            std::string getInputHash(MeshData const& meshData, float const* bmin, float const* bmax) const;
 
         private:
             bool m_bigBaseUnit;
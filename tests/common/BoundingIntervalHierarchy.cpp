@@ -0,0 +1,154 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "WorldModel.h"
+#include <chrono>
+#include <random>
+
+using G3D::Vector3;
+
+namespace
+{
+    struct RandomMesh
+    {
+        std::vector<Vector3> Vertices;
+        std::vector<VMAP::MeshTriangle> Triangles;
+    };
+
+    // small triangles scattered through a 100 yard cube, roughly what a wmo group looks like to a ray
+    RandomMesh CreateRandomMesh(uint32 triangleCount, uint32 seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> position(0.0f, 100.0f);
+        std::uniform_real_distribution<float> offset(-2.0f, 2.0f);
+
+        RandomMesh mesh;
+        for (uint32 i = 0; i < triangleCount; ++i)
+        {
+            Vector3 center(position(rng), position(rng), position(rng));
+            uint32 first = uint32(mesh.Vertices.size());
+            for (uint32 v = 0; v < 3; ++v)
+                mesh.Vertices.emplace_back(center + Vector3(offset(rng), offset(rng), offset(rng)));
+            mesh.Triangles.emplace_back(first, first + 1, first + 2);
+        }
+        return mesh;
+    }
+
+    std::vector<G3D::Ray> CreateRandomRays(uint32 count, uint32 seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> position(-10.0f, 110.0f);
+
+        std::vector<G3D::Ray> rays;
+        for (uint32 i = 0; i < count; ++i)
+        {
+            Vector3 from(position(rng), position(rng), position(rng));
+            Vector3 to(position(rng), position(rng), position(rng));
+            rays.push_back(G3D::Ray::fromOriginAndDirection(from, (to - from).directionOrZero()));
+        }
+        return rays;
+    }
+
+    float BruteForceHit(RandomMesh const& mesh, G3D::Ray const& ray, float maxDist)
+    {
+        for (VMAP::MeshTriangle const& tri : mesh.Triangles)
+        {
+            Vector3 const e1 = mesh.Vertices[tri.idx1] - mesh.Vertices[tri.idx0];
+            Vector3 const e2 = mesh.Vertices[tri.idx2] - mesh.Vertices[tri.idx0];
+            Vector3 const p = ray.direction().cross(e2);
+            float const a = e1.dot(p);
+            if (std::fabs(a) < 1e-5f)
+                continue;
+
+            float const f = 1.0f / a;
+            Vector3 const s = ray.origin() - mesh.Vertices[tri.idx0];
+            float const u = f * s.dot(p);
+            if (u < 0.0f || u > 1.0f)
+                continue;
+
+            Vector3 const q = s.cross(e1);
+            float const v = f * ray.direction().dot(q);
+            if (v < 0.0f || u + v > 1.0f)
+                continue;
+
+            float const t = f * e2.dot(q);
+            if (t > 0.0f && t < maxDist)
+                maxDist = t;
+        }
+        return maxDist;
+    }
+}
+
+TEST_CASE("GroupModel ray intersection after tree ordering", "[BIH]")
+{
+    RandomMesh mesh = CreateRandomMesh(2000, 1);
+    std::vector<G3D::Ray> rays = CreateRandomRays(500, 2);
+
+    std::vector<Vector3> vertices = mesh.Vertices;
+    std::vector<VMAP::MeshTriangle> triangles = mesh.Triangles;
+    VMAP::GroupModel model(0, 0, G3D::AABox(Vector3(0.0f, 0.0f, 0.0f), Vector3(100.0f, 100.0f, 100.0f)));
+    model.setMeshData(vertices, triangles);
+
+    std::vector<Vector3> sortedVertices;
+    std::vector<VMAP::MeshTriangle> sortedTriangles;
+    VMAP::WmoLiquid* liquid = nullptr;
+    model.getMeshData(sortedVertices, sortedTriangles, liquid);
+    REQUIRE(sortedVertices.size() == mesh.Vertices.size());
+    REQUIRE(sortedTriangles.size() == mesh.Triangles.size());
+
+    for (G3D::Ray const& ray : rays)
+    {
+        float const maxDist = 200.0f;
+        float expected = BruteForceHit(mesh, ray, maxDist);
+
+        float distance = maxDist;
+        bool hit = model.IntersectRay(ray, distance, false);
+        REQUIRE(hit == (expected < maxDist));
+        if (hit)
+            REQUIRE(distance == Approx(expected));
+    }
+}
+
+TEST_CASE("GroupModel ray intersection throughput", "[.][BIH][benchmark]")
+{
+    RandomMesh mesh = CreateRandomMesh(50000, 3);
+    std::vector<G3D::Ray> rays = CreateRandomRays(20000, 4);
+
+    VMAP::GroupModel model(0, 0, G3D::AABox(Vector3(0.0f, 0.0f, 0.0f), Vector3(100.0f, 100.0f, 100.0f)));
+    model.setMeshData(mesh.Vertices, mesh.Triangles);
+
+    for (bool stopAtFirstHit : { true, false })
+    {
+        uint32 hits = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (uint32 pass = 0; pass < 10; ++pass)
+        {
+            for (G3D::Ray const& ray : rays)
+            {
+                float distance = 200.0f;
+                if (model.IntersectRay(ray, distance, stopAtFirstHit))
+                    ++hits;
+            }
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        WARN((stopAtFirstHit ? "first hit: " : "closest hit: ")
+            << uint64(rays.size() * 10 / elapsed.count()) << " rays/sec (" << hits << " hits)");
+    }
+}
@@ -0,0 +1,127 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "BoundingIntervalHierarchyWrapper.h"
+#include <G3D/AABox.h>
+#include <G3D/Ray.h>
+
+namespace
+{
+    struct TestBox
+    {
+        G3D::AABox Bounds;
+    };
+
+    struct TestBoxBounds
+    {
+        static void getBounds2(TestBox const* box, G3D::AABox& out) { out = box->Bounds; }
+    };
+
+    struct RayHits
+    {
+        bool operator()(G3D::Ray const& ray, TestBox const& box, float& distance)
+        {
+            float time = ray.intersectionTime(box.Bounds);
+            if (time == G3D::finf() || time > distance)
+                return false;
+
+            distance = time;
+            Hit = &box;
+            return true;
+        }
+
+        TestBox const* Hit = nullptr;
+    };
+
+    TestBox MakeBox(float x)
+    {
+        return { G3D::AABox(G3D::Vector3(x, -1.0f, -1.0f), G3D::Vector3(x + 1.0f, 1.0f, 1.0f)) };
+    }
+
+    TestBox const* CastRay(BIHWrap<TestBox, TestBoxBounds>& tree)
+    {
+        RayHits callback;
+        float distance = 1000.0f;
+        tree.intersectRay(G3D::Ray::fromOriginAndDirection(G3D::Vector3(-10.0f, 0.0f, 0.0f), G3D::Vector3(1.0f, 0.0f, 0.0f)), callback, distance);
+        return callback.Hit;
+    }
+}
+
+TEST_CASE("BIHWrap incremental updates", "[BIH]")
+{
+    BIHWrap<TestBox, TestBoxBounds> tree;
+    TestBox box = MakeBox(5.0f);
+
+    SECTION("Pending objects are found before any rebuild")
+    {
+        tree.insert(box);
+        REQUIRE(!tree.needsRebuild());
+        REQUIRE(CastRay(tree) == &box);
+    }
+
+    SECTION("Pending objects in front of a tree hit are reported")
+    {
+        tree.insert(box);
+        tree.balance();
+
+        TestBox closer = MakeBox(0.0f);
+        tree.insert(closer);
+        REQUIRE(!tree.needsRebuild());
+        REQUIRE(CastRay(tree) == &closer);
+    }
+
+    SECTION("Objects are found after a rebuild and gone after removal")
+    {
+        tree.insert(box);
+        tree.balance();
+        REQUIRE(CastRay(tree) == &box);
+
+        tree.remove(box);
+        REQUIRE(CastRay(tree) == nullptr);
+    }
+
+    SECTION("Moving an object does not require a rebuild")
+    {
+        tree.insert(box);
+        tree.balance();
+        for (float x = 5.0f; x < 50.0f; x += 5.0f)
+        {
+            tree.remove(box);
+            box = MakeBox(x);
+            tree.insert(box);
+            REQUIRE(CastRay(tree) == &box);
+        }
+        REQUIRE(!tree.needsRebuild());
+    }
+
+    SECTION("Long pending list asks for a rebuild")
+    {
+        std::vector<TestBox> boxes;
+        for (uint32 i = 0; i < 16; ++i)
+            boxes.push_back(MakeBox(float(i) * 2.0f));
+
+        for (TestBox const& pending : boxes)
+            tree.insert(pending);
+
+        REQUIRE(tree.needsRebuild());
+        tree.balance();
+        REQUIRE(!tree.needsRebuild());
+        REQUIRE(CastRay(tree) != nullptr);
+    }
+}
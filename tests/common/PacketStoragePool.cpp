@@ -0,0 +1,130 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "PacketStoragePool.h"
+#include <set>
+#include <thread>
+
+namespace
+{
+    std::vector<uint8> MakeStorage(std::size_t capacity)
+    {
+        std::vector<uint8> storage;
+        storage.reserve(capacity);
+        return storage;
+    }
+}
+
+TEST_CASE("PacketStoragePool", "[PacketStoragePool]")
+{
+    PacketStoragePool::Statistics before = PacketStoragePool::GetStatistics();
+
+    SECTION("Requests are rounded up to their size class")
+    {
+        REQUIRE(PacketStoragePool::Acquire(0).capacity() == 0);
+        REQUIRE(PacketStoragePool::Acquire(1).capacity() >= 256);
+        REQUIRE(PacketStoragePool::Acquire(256).capacity() >= 256);
+        REQUIRE(PacketStoragePool::Acquire(257).capacity() >= 1024);
+        REQUIRE(PacketStoragePool::Acquire(5000).capacity() >= 16384);
+
+        std::vector<uint8> huge = PacketStoragePool::Acquire(100000);
+        REQUIRE(huge.capacity() >= 100000);
+        REQUIRE(huge.empty());
+    }
+
+    SECTION("Released storage is handed out again on the same thread")
+    {
+        std::vector<uint8> storage = PacketStoragePool::Acquire(1024);
+        storage.resize(700, 0xAB);
+        uint8 const* data = storage.data();
+        PacketStoragePool::Release(std::move(storage));
+
+        std::vector<uint8> reused = PacketStoragePool::Acquire(900);
+        REQUIRE(reused.data() == data);
+        REQUIRE(reused.empty());
+
+        PacketStoragePool::Statistics after = PacketStoragePool::GetStatistics();
+        REQUIRE(after.Recycled == before.Recycled + 1);
+        REQUIRE(after.Hits > before.Hits);
+    }
+
+    SECTION("Grown storage serves the largest class it can hold")
+    {
+        std::vector<uint8> storage = MakeStorage(1500);
+        uint8 const* data = storage.data();
+        PacketStoragePool::Release(std::move(storage));
+
+        // too large for the 1024 class it was released to
+        REQUIRE(PacketStoragePool::Acquire(2000).data() != data);
+        REQUIRE(PacketStoragePool::Acquire(1024).data() == data);
+    }
+
+    SECTION("Too small and oversize storage is discarded")
+    {
+        PacketStoragePool::Release(MakeStorage(100));
+        PacketStoragePool::Release(MakeStorage(65536 * 2 + 1));
+
+        PacketStoragePool::Statistics after = PacketStoragePool::GetStatistics();
+        REQUIRE(after.Discarded == before.Discarded + 2);
+        REQUIRE(after.Recycled == before.Recycled);
+    }
+
+    SECTION("Storage released on another thread is reused through the shared list")
+    {
+        // the largest class keeps only 2 buffers per thread, the rest overflows into the shared list
+        std::set<uint8 const*> released;
+        std::thread([&released]()
+        {
+            std::vector<std::vector<uint8>> storages;
+            for (uint32 i = 0; i < 8; ++i)
+                storages.push_back(MakeStorage(65536));
+
+            for (std::vector<uint8>& storage : storages)
+            {
+                released.insert(storage.data());
+                PacketStoragePool::Release(std::move(storage));
+            }
+        }).join();
+
+        PacketStoragePool::Statistics afterRelease = PacketStoragePool::GetStatistics();
+        std::vector<uint8> reused = PacketStoragePool::Acquire(65536);
+        REQUIRE(PacketStoragePool::GetStatistics().Hits == afterRelease.Hits + 1);
+        REQUIRE(released.count(reused.data()) == 1);
+    }
+
+    SECTION("Storage released after the thread cache was destroyed is freed")
+    {
+        std::thread([]()
+        {
+            // constructed before the pool's cache on this thread, so it is destroyed after it
+            struct ReleaseOnThreadExit
+            {
+                ~ReleaseOnThreadExit() { PacketStoragePool::Release(std::move(Storage)); }
+                std::vector<uint8> Storage;
+            };
+            static thread_local ReleaseOnThreadExit releaseOnExit;
+
+            releaseOnExit.Storage = MakeStorage(1024);
+            PacketStoragePool::Release(PacketStoragePool::Acquire(256));
+        }).join();
+
+        PacketStoragePool::Statistics after = PacketStoragePool::GetStatistics();
+        REQUIRE(after.Discarded == before.Discarded + 1);
+    }
+}
@@ -0,0 +1,125 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "Define.h"
+#include "ShardedMap.h"
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Insert, lookup and erase", "[ShardedMap]")
+{
+    Trinity::Containers::ShardedMap<uint64, int const*> map;
+    std::vector<int> values(1000);
+
+    for (uint64 i = 0; i < values.size(); ++i)
+        map.insert_or_assign(i, &values[i]);
+
+    REQUIRE(map.size() == values.size());
+    for (uint64 i = 0; i < values.size(); ++i)
+        REQUIRE(map.lookup(i) == &values[i]);
+
+    REQUIRE(map.lookup(values.size()) == nullptr);
+
+    REQUIRE(map.erase(5) == true);
+    REQUIRE(map.erase(5) == false);
+    REQUIRE(map.lookup(5) == nullptr);
+    REQUIRE(map.size() == values.size() - 1);
+
+    map.insert_or_assign(6, &values[0]);
+    REQUIRE(map.lookup(6) == &values[0]);
+    REQUIRE(map.size() == values.size() - 1);
+}
+
+TEST_CASE("String keys", "[ShardedMap]")
+{
+    Trinity::Containers::ShardedMap<std::string, int> map;
+    map.insert_or_assign("Arthas", 1);
+    map.insert_or_assign("Jaina", 2);
+
+    REQUIRE(map.lookup("Arthas") == 1);
+    REQUIRE(map.lookup("Jaina") == 2);
+    REQUIRE(map.lookup("Thrall") == 0);
+}
+
+// Not run by default, use `tests "[ShardedMap][benchmark]"`
+TEST_CASE("Concurrent lookup throughput", "[.][ShardedMap][benchmark]")
+{
+    constexpr uint64 KeyCount = 5000;
+    constexpr std::chrono::milliseconds Duration(1000);
+
+    Trinity::Containers::ShardedMap<uint64, uint64> map;
+    for (uint64 i = 0; i < KeyCount; ++i)
+        map.insert_or_assign(i, i + 1);
+
+    for (uint32 readerCount : { 1u, 2u, 4u, 8u })
+    {
+        std::atomic<bool> stop = false;
+        std::atomic<uint64> lookups = 0;
+        std::atomic<uint64> misses = 0;
+        std::vector<std::thread> readers;
+
+        for (uint32 r = 0; r < readerCount; ++r)
+        {
+            readers.emplace_back([&, r]()
+            {
+                uint64 done = 0;
+                uint64 missed = 0;
+                uint64 key = r * 7919;
+                while (!stop.load(std::memory_order_relaxed))
+                {
+                    for (uint32 i = 0; i < 1024; ++i)
+                    {
+                        key = (key + 7919) % KeyCount;
+                        if (map.lookup(key) != key + 1)
+                            ++missed;
+                    }
+                    done += 1024;
+                }
+
+                lookups += done;
+                misses += missed;
+            });
+        }
+
+        // a single writer logging players in and out while the readers run
+        std::thread writer([&]()
+        {
+            uint64 key = KeyCount;
+            while (!stop.load(std::memory_order_relaxed))
+            {
+                map.insert_or_assign(key, key + 1);
+                map.erase(key);
+                ++key;
+            }
+        });
+
+        std::this_thread::sleep_for(Duration);
+        stop = true;
+        writer.join();
+        for (std::thread& reader : readers)
+            reader.join();
+
+        REQUIRE(misses == 0);
+        WARN(readerCount << " readers + 1 writer: "
+            << lookups * 1000 / Duration.count() << " lookups/sec");
+    }
+}
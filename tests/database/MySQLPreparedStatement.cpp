@@ -0,0 +1,45 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "MySQLPreparedStatement.h"
+
+TEST_CASE("Multi row insert", "[MySQLPreparedStatement]")
+{
+    SECTION("Repeats the values row")
+    {
+        REQUIRE(MySQLPreparedStatement::BuildMultiRowInsert("INSERT INTO character_skills (guid, skill, value, max) VALUES (?, ?, ?, ?)", 1)
+            == "INSERT INTO character_skills (guid, skill, value, max) VALUES (?, ?, ?, ?)");
+        REQUIRE(MySQLPreparedStatement::BuildMultiRowInsert("INSERT INTO character_skills (guid, skill, value, max) VALUES (?, ?, ?, ?)", 3)
+            == "INSERT INTO character_skills (guid, skill, value, max) VALUES (?, ?, ?, ?), (?, ?, ?, ?), (?, ?, ?, ?)");
+        REQUIRE(MySQLPreparedStatement::BuildMultiRowInsert("REPLACE INTO character_inventory (guid, bag, slot, item) VALUES (?, ?, ?, ?)", 2)
+            == "REPLACE INTO character_inventory (guid, bag, slot, item) VALUES (?, ?, ?, ?), (?, ?, ?, ?)");
+        REQUIRE(MySQLPreparedStatement::BuildMultiRowInsert("INSERT IGNORE INTO account_data VALUES (?, ?, UNIX_TIMESTAMP(), ')')", 2)
+            == "INSERT IGNORE INTO account_data VALUES (?, ?, UNIX_TIMESTAMP(), ')'), (?, ?, UNIX_TIMESTAMP(), ')')");
+    }
+
+    SECTION("Rejects statements that can not be repeated")
+    {
+        REQUIRE(MySQLPreparedStatement::BuildMultiRowInsert("UPDATE characters SET level = ? WHERE guid = ?", 2).empty());
+        REQUIRE(MySQLPreparedStatement::BuildMultiRowInsert("DELETE FROM character_spell WHERE guid = ?", 2).empty());
+        REQUIRE(MySQLPreparedStatement::BuildMultiRowInsert("INSERT INTO character_pet_declinedname SELECT ?, owner, ? FROM character_pet WHERE id = ?", 2).empty());
+        REQUIRE(MySQLPreparedStatement::BuildMultiRowInsert("INSERT INTO item_refund_instance (item_guid) VALUES (?) ON DUPLICATE KEY UPDATE item_guid = ?", 2).empty());
+        REQUIRE(MySQLPreparedStatement::BuildMultiRowInsert("INSERT INTO character_spell (guid, spell) VALUES (?, ?), (?, ?)", 2).empty());
+        REQUIRE(MySQLPreparedStatement::BuildMultiRowInsert("INSERT INTO character_spell (guid, spell) VALUES (?, ?)", 0).empty());
+    }
+}
@@ -0,0 +1,127 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "Map.h"
+#include <boost/filesystem/operations.hpp>
+#include <fstream>
+#include <vector>
+
+namespace
+{
+    // writes a .map file holding only height data in the requested storage format
+    template<typename T>
+    void WriteHeightMap(std::string const& fileName, uint32 heightFlags, float gridHeight, float gridMaxHeight)
+    {
+        map_fileheader header = { };
+        header.mapMagic = { { 'M', 'A', 'P', 'S' } };
+        header.versionMagic = 10;
+        header.heightMapOffset = sizeof(map_fileheader);
+
+        map_heightHeader heightHeader = { };
+        heightHeader.fourcc = u_map_magic{ { 'M', 'H', 'G', 'T' } }.asUInt;
+        heightHeader.flags = heightFlags;
+        heightHeader.gridHeight = gridHeight;
+        heightHeader.gridMaxHeight = gridMaxHeight;
+
+        std::vector<T> v9(129 * 129);
+        std::vector<T> v8(128 * 128);
+        for (std::size_t i = 0; i < v9.size(); ++i)
+            v9[i] = T((i * 7919) % 200);
+        for (std::size_t i = 0; i < v8.size(); ++i)
+            v8[i] = T((i * 104729) % 200);
+
+        std::ofstream file(fileName, std::ios::binary);
+        file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+        file.write(reinterpret_cast<char const*>(&heightHeader), sizeof(heightHeader));
+        if (!(heightFlags & MAP_HEIGHT_NO_HEIGHT))
+        {
+            file.write(reinterpret_cast<char const*>(v9.data()), v9.size() * sizeof(T));
+            file.write(reinterpret_cast<char const*>(v8.data()), v8.size() * sizeof(T));
+        }
+    }
+
+    void CheckBatchMatchesSinglePoints(std::string const& fileName)
+    {
+        GridMap grid;
+        REQUIRE(grid.loadData(fileName.c_str()));
+
+        // points spread over the whole grid, including cell and triangle edges
+        std::vector<float> x, y;
+        for (int i = 0; i <= 64; ++i)
+        {
+            for (int j = 0; j <= 64; ++j)
+            {
+                x.push_back(i * (SIZE_OF_GRIDS / 64) + j * 0.37f);
+                y.push_back(j * (SIZE_OF_GRIDS / 64) + i * 0.53f);
+            }
+        }
+
+        std::vector<float> heights(x.size());
+        grid.getHeights(x.data(), y.data(), heights.data(), heights.size());
+
+        for (std::size_t i = 0; i < x.size(); ++i)
+            REQUIRE(heights[i] == Approx(grid.getHeight(x[i], y[i])));
+    }
+
+    // removes the file once the test is done with it, the GridMap reading it is gone by then
+    struct TempMapFile
+    {
+        TempMapFile() : Name((boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%-%%%%-%%%%.map")).string()) { }
+        ~TempMapFile()
+        {
+            boost::system::error_code error;
+            boost::filesystem::remove(Name, error);
+        }
+
+        TempMapFile(TempMapFile const&) = delete;
+        TempMapFile& operator=(TempMapFile const&) = delete;
+
+        std::string Name;
+    };
+}
+
+TEST_CASE("GridMap batched heights", "[GridMap]")
+{
+    TempMapFile file;
+    std::string const& fileName = file.Name;
+
+    SECTION("float heights")
+    {
+        WriteHeightMap<float>(fileName, 0, -10.0f, 190.0f);
+        CheckBatchMatchesSinglePoints(fileName);
+    }
+
+    SECTION("uint16 heights")
+    {
+        WriteHeightMap<uint16>(fileName, MAP_HEIGHT_AS_INT16, -10.0f, 190.0f);
+        CheckBatchMatchesSinglePoints(fileName);
+    }
+
+    SECTION("uint8 heights")
+    {
+        WriteHeightMap<uint8>(fileName, MAP_HEIGHT_AS_INT8, -10.0f, 190.0f);
+        CheckBatchMatchesSinglePoints(fileName);
+    }
+
+    SECTION("flat grid")
+    {
+        WriteHeightMap<float>(fileName, MAP_HEIGHT_NO_HEIGHT, 42.0f, 42.0f);
+        CheckBatchMatchesSinglePoints(fileName);
+    }
+}
@@ -0,0 +1,78 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "PathCache.h"
+#include <array>
+
+TEST_CASE("PathCache", "[PathCache]")
+{
+    PathCache cache;
+    PathCache::Key key{ 10, 20, 0x1, 0x2 };
+    std::array<dtPolyRef, 3> path = { 10, 15, 20 };
+
+    std::array<dtPolyRef, 8> result = { };
+    uint32 length = 0;
+
+    SECTION("Miss on empty cache")
+    {
+        REQUIRE(!cache.Find(key, result.data(), length, uint32(result.size())));
+        REQUIRE(length == 0);
+    }
+
+    SECTION("Stored corridor is returned")
+    {
+        cache.Store(key, path.data(), uint32(path.size()));
+        REQUIRE(cache.Find(key, result.data(), length, uint32(result.size())));
+        REQUIRE(length == path.size());
+        REQUIRE(std::equal(path.begin(), path.end(), result.begin()));
+    }
+
+    SECTION("Filter flags are part of the key")
+    {
+        cache.Store(key, path.data(), uint32(path.size()));
+        PathCache::Key otherFilter = key;
+        otherFilter.ExcludeFlags = 0x4;
+        REQUIRE(!cache.Find(otherFilter, result.data(), length, uint32(result.size())));
+    }
+
+    SECTION("Corridor longer than the output buffer is not returned")
+    {
+        cache.Store(key, path.data(), uint32(path.size()));
+        REQUIRE(!cache.Find(key, result.data(), length, 2));
+    }
+
+    SECTION("Store replaces the previous corridor")
+    {
+        cache.Store(key, path.data(), uint32(path.size()));
+        std::array<dtPolyRef, 2> shorter = { 10, 20 };
+        cache.Store(key, shorter.data(), uint32(shorter.size()));
+        REQUIRE(cache.GetSize() == 1);
+        REQUIRE(cache.Find(key, result.data(), length, uint32(result.size())));
+        REQUIRE(length == 2);
+        REQUIRE(result[1] == 20);
+    }
+
+    SECTION("Clear drops everything")
+    {
+        cache.Store(key, path.data(), uint32(path.size()));
+        cache.Clear();
+        REQUIRE(cache.GetSize() == 0);
+        REQUIRE(!cache.Find(key, result.data(), length, uint32(result.size())));
+    }
+}
@@ -0,0 +1,210 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "GridDefines.h"
+#include "UnitPositionIndex.h"
+#include <algorithm>
+#include <array>
+#include <map>
+
+namespace
+{
+    // the index never dereferences units when given explicit positions, any distinct addresses do
+    struct FakeUnits
+    {
+        Unit* operator[](std::size_t i) { return reinterpret_cast<Unit*>(&Storage[i]); }
+
+        std::array<uint64, 512> Storage = { };
+    };
+
+    struct IndexedPosition
+    {
+        float X;
+        float Y;
+    };
+
+    std::vector<Unit*> Query(UnitPositionIndex const& index, float x, float y, float radius)
+    {
+        std::vector<Unit*> units;
+        index.GetUnitsInRange(x, y, radius, units);
+        std::sort(units.begin(), units.end());
+        return units;
+    }
+
+    std::vector<Unit*> QueryBruteForce(std::map<Unit*, IndexedPosition> const& positions, float x, float y, float radius)
+    {
+        std::vector<Unit*> units;
+        for (auto const& [unit, position] : positions)
+        {
+            float dx = position.X - x;
+            float dy = position.Y - y;
+            if (dx * dx + dy * dy <= radius * radius)
+                units.push_back(unit);
+        }
+        return units;
+    }
+
+    // coordinate of the lower edge of the n-th bucket, buckets are 16 yards wide starting at -MAP_HALFSIZE
+    float BucketEdge(uint32 n)
+    {
+        return -MAP_HALFSIZE + n * 16.0f;
+    }
+}
+
+TEST_CASE("UnitPositionIndex", "[UnitPositionIndex]")
+{
+    UnitPositionIndex index;
+    FakeUnits units;
+
+    SECTION("Empty index finds nothing")
+    {
+        REQUIRE(Query(index, 0.0f, 0.0f, 100.0f).empty());
+        REQUIRE(Query(index, 0.0f, 0.0f, MAP_SIZE).empty());
+    }
+
+    SECTION("Inserted unit is found within the radius only")
+    {
+        index.Insert(units[0], 100.0f, 200.0f);
+
+        REQUIRE(Query(index, 100.0f, 200.0f, 0.0f) == std::vector<Unit*>{ units[0] });
+        REQUIRE(Query(index, 103.0f, 204.0f, 5.0f) == std::vector<Unit*>{ units[0] });
+        REQUIRE(Query(index, 103.0f, 204.0f, 4.99f).empty());
+    }
+
+    SECTION("Inserting twice relocates")
+    {
+        index.Insert(units[0], 100.0f, 200.0f);
+        index.Insert(units[0], 500.0f, 200.0f);
+
+        REQUIRE(Query(index, 100.0f, 200.0f, 10.0f).empty());
+        REQUIRE(Query(index, 500.0f, 200.0f, 10.0f) == std::vector<Unit*>{ units[0] });
+    }
+
+    SECTION("Relocate within and across buckets")
+    {
+        index.Insert(units[0], BucketEdge(1000) + 1.0f, BucketEdge(1000) + 1.0f);
+
+        // same bucket
+        index.Relocate(units[0], BucketEdge(1000) + 15.0f, BucketEdge(1000) + 1.0f);
+        REQUIRE(Query(index, BucketEdge(1000) + 1.0f, BucketEdge(1000) + 1.0f, 1.0f).empty());
+        REQUIRE(Query(index, BucketEdge(1000) + 15.0f, BucketEdge(1000) + 1.0f, 1.0f) == std::vector<Unit*>{ units[0] });
+
+        // neighbour bucket, then far away
+        index.Relocate(units[0], BucketEdge(1001) + 1.0f, BucketEdge(1000) + 1.0f);
+        REQUIRE(Query(index, BucketEdge(1000) + 15.0f, BucketEdge(1000) + 1.0f, 1.0f).empty());
+        REQUIRE(Query(index, BucketEdge(1001) + 1.0f, BucketEdge(1000) + 1.0f, 1.0f) == std::vector<Unit*>{ units[0] });
+
+        index.Relocate(units[0], -3000.0f, 4000.0f);
+        REQUIRE(Query(index, BucketEdge(1001) + 1.0f, BucketEdge(1000) + 1.0f, 1.0f).empty());
+        REQUIRE(Query(index, -3000.0f, 4000.0f, 1.0f) == std::vector<Unit*>{ units[0] });
+    }
+
+    SECTION("Relocating or removing a unit that was never inserted does nothing")
+    {
+        index.Relocate(units[0], 0.0f, 0.0f);
+        index.Remove(units[0]);
+        REQUIRE(Query(index, 0.0f, 0.0f, 10.0f).empty());
+    }
+
+    SECTION("Removing from the middle of a bucket keeps the moved unit relocatable")
+    {
+        // all in one bucket, removing the first moves the last into its slot
+        for (std::size_t i = 0; i < 4; ++i)
+            index.Insert(units[i], BucketEdge(500) + 1.0f + i, BucketEdge(500) + 1.0f);
+
+        index.Remove(units[0]);
+        REQUIRE(Query(index, BucketEdge(500) + 8.0f, BucketEdge(500) + 8.0f, 16.0f) == std::vector<Unit*>{ units[1], units[2], units[3] });
+
+        // the moved unit must still update its own slot, not the removed one
+        index.Relocate(units[3], BucketEdge(500) + 10.0f, BucketEdge(500) + 10.0f);
+        REQUIRE(Query(index, BucketEdge(500) + 10.0f, BucketEdge(500) + 10.0f, 0.5f) == std::vector<Unit*>{ units[3] });
+        REQUIRE(Query(index, BucketEdge(500) + 4.0f, BucketEdge(500) + 1.0f, 0.5f).empty());
+
+        index.Relocate(units[3], 0.0f, 0.0f);
+        index.Remove(units[1]);
+        REQUIRE(Query(index, BucketEdge(500) + 8.0f, BucketEdge(500) + 8.0f, 16.0f) == std::vector<Unit*>{ units[2] });
+        REQUIRE(Query(index, 0.0f, 0.0f, 1.0f) == std::vector<Unit*>{ units[3] });
+
+        index.Remove(units[2]);
+        index.Remove(units[3]);
+        REQUIRE(Query(index, 0.0f, 0.0f, MAP_SIZE).empty());
+    }
+
+    SECTION("Units on both sides of a bucket edge are found")
+    {
+        index.Insert(units[0], BucketEdge(1066) - 0.01f, BucketEdge(1066) - 0.01f);
+        index.Insert(units[1], BucketEdge(1066) + 0.01f, BucketEdge(1066) - 0.01f);
+        index.Insert(units[2], BucketEdge(1066) - 0.01f, BucketEdge(1066) + 0.01f);
+        index.Insert(units[3], BucketEdge(1066) + 0.01f, BucketEdge(1066) + 0.01f);
+
+        REQUIRE(Query(index, BucketEdge(1066), BucketEdge(1066), 0.1f) == std::vector<Unit*>{ units[0], units[1], units[2], units[3] });
+        REQUIRE(Query(index, BucketEdge(1066) + 0.01f, BucketEdge(1066) + 0.01f, 0.001f) == std::vector<Unit*>{ units[3] });
+    }
+
+    SECTION("Units at the map border are clamped into the outermost buckets")
+    {
+        index.Insert(units[0], -MAP_HALFSIZE - 10.0f, 0.0f);
+        index.Insert(units[1], MAP_HALFSIZE + 10.0f, 0.0f);
+
+        REQUIRE(Query(index, -MAP_HALFSIZE, 0.0f, 10.0f) == std::vector<Unit*>{ units[0] });
+        REQUIRE(Query(index, MAP_HALFSIZE, 0.0f, 10.0f) == std::vector<Unit*>{ units[1] });
+    }
+
+    SECTION("Queries match a brute force search")
+    {
+        std::map<Unit*, IndexedPosition> positions;
+
+        // a cluster around a bucket corner and a few scattered units, then move and remove some of them
+        for (std::size_t i = 0; i < 400; ++i)
+        {
+            IndexedPosition position = { BucketEdge(1066) + float(i % 20) * 2.3f - 23.0f, BucketEdge(1066) + float(i / 20) * 2.3f - 23.0f };
+            if (i % 50 == 0)
+                position = { float(i) * 41.0f - 8000.0f, float(i) * -17.0f + 3000.0f };
+
+            index.Insert(units[i], position.X, position.Y);
+            positions[units[i]] = position;
+        }
+
+        for (std::size_t i = 0; i < 400; i += 7)
+        {
+            IndexedPosition position = { positions[units[i]].X + 9.5f, positions[units[i]].Y - 13.0f };
+            index.Relocate(units[i], position.X, position.Y);
+            positions[units[i]] = position;
+        }
+
+        for (std::size_t i = 0; i < 400; i += 3)
+        {
+            index.Remove(units[i]);
+            positions.erase(units[i]);
+        }
+
+        // small radii visit a few buckets, large ones fall back to scanning every occupied bucket
+        for (float radius : { 0.5f, 5.0f, 16.0f, 30.0f, 100.0f, 5000.0f, MAP_SIZE })
+        {
+            for (float x : { BucketEdge(1066), BucketEdge(1066) - 20.0f, BucketEdge(1067) + 0.5f, 0.0f, -7000.0f })
+            {
+                for (float y : { BucketEdge(1066), BucketEdge(1065) + 3.0f, 2500.0f })
+                {
+                    INFO("x " << x << " y " << y << " radius " << radius);
+                    REQUIRE(Query(index, x, y, radius) == QueryBruteForce(positions, x, y, radius));
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,122 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "UpdateData.h"
+#include <chrono>
+#include <iostream>
+#include <vector>
+#include <zlib.h>
+
+namespace
+{
+    // something shaped like a values update block, guids and fields repeating with small differences
+    std::vector<uint8> MakeUpdatePayload(std::size_t size)
+    {
+        std::vector<uint8> payload(size);
+        for (std::size_t i = 0; i < size; ++i)
+            payload[i] = uint8((i % 64) < 16 ? i / 64 : (i * 31) % 7);
+        return payload;
+    }
+
+    std::vector<uint8> Inflate(std::vector<uint8> const& compressed, std::size_t originalSize)
+    {
+        std::vector<uint8> result(originalSize);
+        uLongf size = uLongf(originalSize);
+        REQUIRE(uncompress(result.data(), &size, compressed.data(), uLong(compressed.size())) == Z_OK);
+        REQUIRE(size == originalSize);
+        return result;
+    }
+
+    // what Compress did before the stream was kept per thread
+    void CompressWithNewStream(void* dst, uint32* dst_size, void const* src, int src_size, int level)
+    {
+        z_stream stream = { };
+        deflateInit(&stream, level);
+        stream.next_out = (Bytef*)dst;
+        stream.avail_out = *dst_size;
+        stream.next_in = (Bytef*)src;
+        stream.avail_in = uInt(src_size);
+        deflate(&stream, Z_FINISH);
+        *dst_size = stream.total_out;
+        deflateEnd(&stream);
+    }
+}
+
+TEST_CASE("Update packet compression", "[UpdateData]")
+{
+    SECTION("Consecutive packets on one thread decompress to their input")
+    {
+        for (std::size_t size : { 101, 4000, 150, 65000 })
+        {
+            std::vector<uint8> payload = MakeUpdatePayload(size);
+            uint32 compressedSize = compressBound(uLong(size));
+            std::vector<uint8> compressed(compressedSize);
+            UpdateData::Compress(compressed.data(), &compressedSize, payload.data(), int(size), 1);
+            REQUIRE(compressedSize != 0);
+
+            compressed.resize(compressedSize);
+            REQUIRE(Inflate(compressed, size) == payload);
+        }
+    }
+
+    SECTION("Changing the level resets the stream")
+    {
+        std::vector<uint8> payload = MakeUpdatePayload(2000);
+        for (int level : { 1, 9, 1 })
+        {
+            uint32 compressedSize = compressBound(uLong(payload.size()));
+            std::vector<uint8> compressed(compressedSize);
+            UpdateData::Compress(compressed.data(), &compressedSize, payload.data(), int(payload.size()), level);
+            REQUIRE(compressedSize != 0);
+
+            compressed.resize(compressedSize);
+            REQUIRE(Inflate(compressed, payload.size()) == payload);
+        }
+    }
+}
+
+// Not run by default, use `tests "[UpdateData][benchmark]"`
+TEST_CASE("Update packet compression throughput", "[.][UpdateData][benchmark]")
+{
+    constexpr uint32 PacketCount = 20000;
+
+    for (std::size_t size : { 200, 1500, 8000 })
+    {
+        std::vector<uint8> payload = MakeUpdatePayload(size);
+        std::vector<uint8> compressed(compressBound(uLong(size)));
+
+        auto measure = [&](auto compress)
+        {
+            auto start = std::chrono::steady_clock::now();
+            for (uint32 i = 0; i < PacketCount; ++i)
+            {
+                uint32 compressedSize = uint32(compressed.size());
+                compress(compressed.data(), &compressedSize, payload.data(), int(size), 1);
+                REQUIRE(compressedSize != 0);
+            }
+            return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+        };
+
+        int64 perThreadStream = measure(UpdateData::Compress);
+        int64 newStream = measure(CompressWithNewStream);
+
+        std::cout << size << " byte packets: " << (perThreadStream * 1000 / PacketCount) << " ns per packet with the thread stream, "
+            << (newStream * 1000 / PacketCount) << " ns with a new stream per packet" << std::endl;
+    }
+}
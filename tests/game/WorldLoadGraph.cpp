@@ -0,0 +1,90 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "WorldLoadGraph.h"
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct LoadOrder
+    {
+        void Loaded(std::string name)
+        {
+            std::lock_guard<std::mutex> lock(Lock);
+            Names.push_back(std::move(name));
+        }
+
+        std::ptrdiff_t IndexOf(std::string const& name) const
+        {
+            return std::find(Names.begin(), Names.end(), name) - Names.begin();
+        }
+
+        std::mutex Lock;
+        std::vector<std::string> Names;
+    };
+}
+
+TEST_CASE("WorldLoadGraph", "[WorldLoadGraph]")
+{
+    LoadOrder order;
+    WorldLoadGraph graph;
+
+    SECTION("Independent steps all load")
+    {
+        for (std::string name : { "a", "b", "c", "d", "e", "f" })
+            graph.AddStep(name, { }, [&order, name]() { order.Loaded(name); });
+
+        graph.Run(4);
+
+        REQUIRE(order.Names.size() == 6);
+        for (std::string name : { "a", "b", "c", "d", "e", "f" })
+            REQUIRE(order.IndexOf(name) < 6);
+    }
+
+    SECTION("Dependants load after their dependencies")
+    {
+        // declared before the steps it depends on on purpose
+        graph.AddStep("gossip", { "trainers", "texts" }, [&order]() { order.Loaded("gossip"); });
+        graph.AddStep("trainers", { }, [&order]() { order.Loaded("trainers"); });
+        graph.AddStep("texts", { }, [&order]() { order.Loaded("texts"); });
+        graph.AddStep("vendors", { "gossip" }, [&order]() { order.Loaded("vendors"); });
+        graph.AddStep("loot", { }, [&order]() { order.Loaded("loot"); });
+
+        graph.Run(4);
+
+        REQUIRE(order.Names.size() == 5);
+        REQUIRE(order.IndexOf("trainers") < order.IndexOf("gossip"));
+        REQUIRE(order.IndexOf("texts") < order.IndexOf("gossip"));
+        REQUIRE(order.IndexOf("gossip") < order.IndexOf("vendors"));
+        REQUIRE(order.IndexOf("loot") < 5);
+    }
+
+    SECTION("A single thread loads everything as well")
+    {
+        graph.AddStep("first", { }, [&order]() { order.Loaded("first"); });
+        graph.AddStep("second", { "first" }, [&order]() { order.Loaded("second"); });
+
+        graph.Run(1);
+
+        REQUIRE(order.Names == std::vector<std::string>{ "first", "second" });
+    }
+}